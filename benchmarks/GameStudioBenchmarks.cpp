@@ -0,0 +1,516 @@
+#include "MicroBenchmark.hpp"
+#include "ai/Puzzle2048MctsAI.hpp"
+#include "ai/TicTacToeMctsAI.hpp"
+#include "core/EngineFactory.hpp"
+#include "core/ReplayPlayer.hpp"
+#include "core/Grid.hpp"
+#include "games/Board2048.hpp"
+#include "games/BuiltinEngines.hpp"
+#include "games/MnkRules.hpp"
+#include "games/Puzzle2048Engine.hpp"
+#include "games/SudokuEngine.hpp"
+#include "games/TicTacToeEngine.hpp"
+#include "observer/Subject.hpp"
+#include "util/Pcg32.hpp"
+#include "util/Replay.hpp"
+#include "util/ScoreBoard.hpp"
+#include "util/ScoreLog.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+/**
+ * Micro-benchmarks of the game engines' hot paths
+ * Engine methods that are private (2048 canMove, Tic-Tac-Toe checkWinner)
+ * are measured through the code they delegate to, with the same arguments.
+ * Sudoku checks call the engine on a fixed puzzle (SudokuEngine::initFixed),
+ * so results do not depend on which puzzle the bank deals.
+ * Links only the SFML-free core library.
+ *
+ * Before the suite runs, global operator new is replaced by a counting hook
+ * and the 2048 move path is checked to make no heap allocation, MCTS
+ * searches with no time budget are checked to still return a legal move,
+ * and a Sudoku session that overwrites a cell is checked to replay without
+ * rejected actions; the program fails if any check does not hold.
+ *
+ * Usage: GameStudioBenchmarks [--filter=SUBSTRING] [--json=FILE] [--min-time=SECONDS] [--repetitions=N]
+ * Compare two --json outputs release over release to spot regressions.
+ */
+
+namespace {
+thread_local std::uint64_t allocationCount = 0;   // Heap allocations made by this thread
+}
+
+// GCC flags free() in the replacement delete as mismatched once it is
+// inlined next to a new-expression; the pair below is matched
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size) {
+    ++allocationCount;
+    if (void* memory = std::malloc(size != 0 ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+constexpr size_t ScoreFileEntries = 100000;
+
+const char* DirectionNames[] = {"Left", "Right", "Up", "Down"};
+
+/**
+ * Boards reached by random play, so moves see realistic tile layouts
+ */
+std::vector<Board2048> make2048Boards(size_t count) {
+    std::mt19937 rng(2048);
+    std::vector<Board2048> boards;
+    Board2048 board;
+    while (boards.size() < count) {
+        if (board.countEmpty() == 16 || !board.canMove()) {
+            board.clear();
+        }
+        const std::uint16_t empty = board.getEmptyMask();
+        std::vector<int> cells;
+        for (int i = 0; i < 16; ++i) {
+            if (empty & (1u << i)) cells.push_back(i);
+        }
+        if (!cells.empty()) {
+            const int cell = cells[rng() % cells.size()];
+            board.setExponent(cell / 4, cell % 4, rng() % 10 == 0 ? 2 : 1);
+        }
+        boards.push_back(board);
+        int gained = 0;
+        board.move(static_cast<Board2048::Direction>(rng() % 4), gained);
+    }
+    return boards;
+}
+
+void writeScoreFiles(const std::string& textFile, const std::string& binaryFile) {
+    std::remove(textFile.c_str());
+    std::remove(binaryFile.c_str());
+    const char* games[] = {"Tic-Tac-Toe", "Gomoku", "Sudoku", "2048"};
+    const char* results[] = {"Winner: X", "Draw", "Solved!", "Score: 2456 (Game Over)"};
+    std::ofstream text(textFile);
+    std::vector<ScoreEntry> batch;
+    batch.reserve(ScoreFileEntries);
+    for (size_t i = 0; i < ScoreFileEntries; ++i) {
+        ScoreEntry entry;
+        entry.timestamp = "2024-03-" + std::to_string(10 + i % 20) + " 12:34:56";
+        entry.playerName = "Player" + std::to_string(i % 50);
+        entry.gameName = games[i % 4];
+        entry.result = results[i % 4];
+        text << entry.timestamp << " | " << entry.gameName << " | " << entry.playerName << " | " << entry.result << "\n";
+        batch.push_back(std::move(entry));
+    }
+    ScoreLog log;
+    log.open(binaryFile);
+    log.append(batch);
+}
+
+void addGridBenchmarks(bench::Suite& suite) {
+    suite.add("Grid<int>::at/read/4x4", [](std::uint64_t iterations) {
+        Grid<int> grid(4, 4, 2);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            int sum = 0;
+            for (size_t r = 0; r < 4; ++r) {
+                for (size_t c = 0; c < 4; ++c) {
+                    sum += grid.at(r, c);
+                }
+            }
+            bench::doNotOptimize(sum);
+        }
+    });
+    suite.add("Grid<int>::at/write/9x9", [](std::uint64_t iterations) {
+        Grid<int> grid(9, 9, 0);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            for (size_t r = 0; r < 9; ++r) {
+                for (size_t c = 0; c < 9; ++c) {
+                    grid.at(r, c) = static_cast<int>(r + c + i);
+                }
+            }
+            bench::doNotOptimize(grid);
+        }
+    });
+    suite.add("Grid<int,4,4>::operator()/read", [](std::uint64_t iterations) {
+        Grid<int, 4, 4> grid(2);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::doNotOptimize(grid);
+            int sum = 0;
+            for (size_t r = 0; r < grid.getRows(); ++r) {
+                for (size_t c = 0; c < grid.getCols(); ++c) {
+                    sum += grid(r, c);
+                }
+            }
+            bench::doNotOptimize(sum);
+        }
+    });
+    suite.add("Grid<int,9,9>::operator()/write", [](std::uint64_t iterations) {
+        Grid<int, 9, 9> grid(0);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            for (size_t r = 0; r < grid.getRows(); ++r) {
+                for (size_t c = 0; c < grid.getCols(); ++c) {
+                    grid(r, c) = static_cast<int>(r + c + i);
+                }
+            }
+            bench::doNotOptimize(grid);
+        }
+    });
+    suite.add("Grid<int,9,9>::col/sum", [](std::uint64_t iterations) {
+        Grid<int, 9, 9> grid(1);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::doNotOptimize(grid);
+            int sum = 0;
+            for (int value : grid.col(i % 9)) {
+                sum += value;
+            }
+            bench::doNotOptimize(sum);
+        }
+    });
+}
+
+void add2048Benchmarks(bench::Suite& suite) {
+    const auto boards = std::make_shared<std::vector<Board2048>>(make2048Boards(4096));
+    for (int dir = 0; dir < 4; ++dir) {
+        suite.add(std::string("2048/move/") + DirectionNames[dir], [boards, dir](std::uint64_t iterations) {
+            const auto direction = static_cast<Board2048::Direction>(dir);
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                Board2048 board = (*boards)[i & 4095];
+                int gained = 0;
+                bench::doNotOptimize(board.move(direction, gained));
+                bench::doNotOptimize(board);
+            }
+        });
+    }
+    suite.add("2048/canMove", [boards](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::doNotOptimize((*boards)[i & 4095].canMove());
+        }
+    });
+    suite.add("2048/init (2x spawnTile)", [](std::uint64_t iterations) {
+        Puzzle2048Engine game(nullptr);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            game.setSeed(static_cast<std::uint32_t>(i));
+            game.init();
+            bench::doNotOptimize(game.getScore());
+        }
+    });
+    suite.add("2048/spawnTile", [](std::uint64_t iterations) {
+        Puzzle2048Engine game(nullptr);
+        game.setSeed(2048);
+        game.init();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            if (game.getBitboard().countEmpty() == 0) {
+                game.setSeed(static_cast<std::uint32_t>(i));
+                game.init();
+            }
+            game.spawnTile();
+        }
+        bench::doNotOptimize(game.getBitboard());
+    });
+    suite.add("2048/applyAction (move+spawnTile+canMove)", [](std::uint64_t iterations) {
+        Puzzle2048Engine game(nullptr);
+        game.setSeed(2048);
+        game.init();
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            if (!game.applyAction(static_cast<int>(i & 3)) && game.isFinished()) {
+                game.setSeed(static_cast<std::uint32_t>(i));
+                game.init();
+            }
+        }
+        bench::doNotOptimize(game.getScore());
+    });
+}
+
+/**
+ * Observer that wants every event, so moves go through the notification queue
+ */
+class NullObserver : public Observer {
+public:
+    void onGameOver(const std::string&, const std::string&, const std::string&) override {}
+    bool wantsEvent(GameEvent::Type /*type*/) const override { return true; }
+};
+
+/**
+ * Count heap allocations on the 2048 move path: slide, tile spawn, game-over
+ * check, move/merge/game-over notifications and restarts
+ * @return Allocations made by this thread
+ */
+std::uint64_t count2048MoveAllocations(Subject& subject, std::uint64_t moves) {
+    Puzzle2048Engine game(&subject);
+    std::uint32_t seed = 1;
+    game.setSeed(seed);
+    game.init();
+    Pcg32 rng(2048);
+    const std::uint64_t before = allocationCount;
+    for (std::uint64_t i = 0; i < moves; ++i) {
+        if (!game.applyAction(static_cast<int>(rng.bounded(4))) && game.isFinished()) {
+            game.setSeed(++seed);
+            game.init();
+        }
+    }
+    return allocationCount - before;
+}
+
+/**
+ * Search with a zero time budget on one and two threads
+ * Regression check: every tree must run at least one playout, so a spent
+ * budget still yields a legal move rather than -1.
+ * @return true if every search returned a legal move
+ */
+bool checkMctsZeroBudget() {
+    for (size_t threads = 1; threads <= 2; ++threads) {
+        Puzzle2048MctsAI::Config config2048;
+        config2048.timeLimitMs = 0;
+        config2048.threads = threads;
+        Puzzle2048MctsAI ai2048(config2048);
+        Board2048 board;
+        board.setExponent(0, 0, 1);
+        board.setExponent(3, 3, 1);
+        if (!ai2048.chooseMove(board)) {
+            return false;
+        }
+
+        TicTacToeMctsAI::Config configMnk;
+        configMnk.timeLimitMs = 0;
+        configMnk.threads = threads;
+        TicTacToeMctsAI aiMnk(configMnk);
+        Grid<char> grid(3, 3, ' ');
+        const int cell = aiMnk.chooseMove(grid, 'X');
+        if (cell < 0 || cell >= 9) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Record a Sudoku session in which a placed digit is overwritten, replay it
+ * and check that every action is accepted and the boards match
+ */
+bool checkSudokuOverwriteReplay() {
+    Replay replay;
+    SudokuEngine recorded;
+    recorded.setRecording(&replay);
+    recorded.setSeed(81);
+    recorded.init();
+
+    // First editable cell with two candidate digits: place one, then the other over it
+    bool overwritten = false;
+    for (int cell = 0; cell < 81 && !overwritten; ++cell) {
+        const int r = cell / 9;
+        const int c = cell % 9;
+        if (recorded.isFixed(r, c)) continue;
+        int first = 0;
+        for (int val = 1; val <= 9 && !overwritten; ++val) {
+            if (!recorded.isValidMove(r, c, val)) continue;
+            if (first == 0) {
+                first = val;
+            } else {
+                overwritten = recorded.placeNumber(r, c, first) && recorded.placeNumber(r, c, val);
+            }
+        }
+    }
+    recorded.setRecording(nullptr);
+    if (!overwritten) {
+        return false;
+    }
+
+    SudokuEngine replayed;
+    ReplayPlayer player(replay, replayed);
+    player.runToEnd();
+    if (player.getRejected() != 0) {
+        return false;
+    }
+    for (int cell = 0; cell < 81; ++cell) {
+        if (replayed.getBoard()(cell / 9, cell % 9) != recorded.getBoard()(cell / 9, cell % 9)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void addSudokuBenchmarks(bench::Suite& suite) {
+    // Arto Inkala's puzzle, half filled from its solution
+    const char* solution = "812753649943682175675491283154237896369845721287169534521974368438526917796318452";
+    SudokuSolver::Puzzle puzzle{};
+    for (int idx = 0; idx < 81; idx += 2) {
+        puzzle[idx] = static_cast<std::uint8_t>(solution[idx] - '0');
+    }
+    const auto engine = std::make_shared<SudokuEngine>();
+    engine->initFixed(puzzle);
+    // Every cell and digit, so filled cells also take the "digit already in the cell" branch
+    suite.add("Sudoku/isValidMove", [engine](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const int r = static_cast<int>(i % 9);
+            const int c = static_cast<int>((i / 9) % 9);
+            const int val = static_cast<int>((i / 81) % 9) + 1;
+            bench::doNotOptimize(engine->isValidMove(r, c, val));
+        }
+    });
+    suite.add("Sudoku/isSolved", [engine](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            bench::doNotOptimize(engine->isSolved());
+        }
+    });
+}
+
+void addTicTacToeBenchmarks(bench::Suite& suite) {
+    suite.add("TicTacToe/checkWinner/3x3", [](std::uint64_t iterations) {
+        Grid<char> board(3, 3, ' ');
+        const char* layout = "XOXXOOOXX";
+        for (int i = 0; i < 9; ++i) board.at(i / 3, i % 3) = layout[i];
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const int cell = static_cast<int>(i % 9);
+            bench::doNotOptimize(MnkRules::findWin(board, cell / 3, cell % 3, 3));
+        }
+    });
+    suite.add("TicTacToe/checkWinner/15x15", [](std::uint64_t iterations) {
+        Grid<char> board(15, 15, ' ');
+        std::mt19937 rng(15);
+        for (int i = 0; i < 120; ++i) board.at(rng() % 15, rng() % 15) = (i % 2) ? 'O' : 'X';
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            const int cell = static_cast<int>(i % 225);
+            bench::doNotOptimize(MnkRules::findWin(board, cell / 15, cell % 15, 5));
+        }
+    });
+    suite.add("TicTacToe/applyAction/15x15/noOpponent", [](std::uint64_t iterations) {
+        // Both sides are played here, so the built-in AI is switched off
+        TicTacToeEngine engine(nullptr, 15, 15, 5, "Gomoku");
+        engine.setVsAI(false);
+        engine.setSeed(15);
+        engine.init();
+        int cell = 0;
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            if (engine.isFinished() || cell == 225) {
+                engine.init();
+                cell = 0;
+            }
+            bench::doNotOptimize(engine.applyAction(cell++));
+        }
+    });
+    suite.add("TicTacToe/aiReply/15x15/depth2", [](std::uint64_t iterations) {
+        // Depth-limited, so each reply does the same work whatever the machine speed
+        TicTacToeEngine engine(nullptr, 15, 15, 5, "Gomoku");
+        engine.setAILimits(60000, 2);
+        engine.setSeed(15);
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            engine.init();
+            engine.applyAction(7 * 15 + 7);
+            bench::doNotOptimize(engine.playAIMove());
+        }
+    });
+}
+
+void addScoreBoardBenchmarks(bench::Suite& suite, const std::string& textFile, const std::string& binaryFile) {
+    const std::string suffix = "/" + std::to_string(ScoreFileEntries);
+    suite.add("ScoreBoard/load+getEntries/text" + suffix, [textFile](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            ScoreBoard board(textFile);
+            bench::doNotOptimize(board.getEntries().size());
+        }
+    });
+    suite.add("ScoreBoard/load+getEntries/binary" + suffix, [binaryFile](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            ScoreBoard board(binaryFile);
+            bench::doNotOptimize(board.getEntries().size());
+        }
+    });
+    suite.add("ScoreBoard/load/binary" + suffix, [binaryFile](std::uint64_t iterations) {
+        for (std::uint64_t i = 0; i < iterations; ++i) {
+            ScoreBoard board(binaryFile);
+            bench::doNotOptimize(board.getTotalGamesPlayed());
+        }
+    });
+}
+
+void addFactoryBenchmarks(bench::Suite& suite, EngineFactory& factory) {
+    // Sorted so the JSON output lists benchmarks in a stable order
+    std::vector<std::string> names = factory.getGameNames();
+    std::sort(names.begin(), names.end());
+    for (const std::string& name : names) {
+        suite.add("EngineFactory::create/" + name, [&factory, name](std::uint64_t iterations) {
+            for (std::uint64_t i = 0; i < iterations; ++i) {
+                auto game = factory.create(name);
+                bench::doNotOptimize(game.get());
+            }
+        });
+    }
+}
+}
+
+int main(int argc, char* argv[]) {
+    bench::Options options;
+    if (!bench::parseOptions(argc, argv, options)) {
+        return 1;
+    }
+
+    const std::string textFile = "bench_scores.txt";
+    const std::string binaryFile = "bench_scores.bin";
+    writeScoreFiles(textFile, binaryFile);
+
+    Subject subject;
+    EngineFactory factory;
+    BuiltinEngines::registerAll(factory, subject);
+
+    {
+        // Subject's dispatcher thread allocates for observers; only this thread is counted
+        Subject listened;
+        NullObserver observer;
+        listened.addObserver(&observer);
+        constexpr std::uint64_t CheckedMoves = 100000;
+        const std::uint64_t allocations = count2048MoveAllocations(listened, CheckedMoves);
+        std::cout << "2048 move path: " << allocations << " heap allocations in " << CheckedMoves << " moves"
+                  << std::endl;
+        listened.removeObserver(&observer);
+        if (allocations != 0) {
+            std::cerr << "error: the 2048 move path must not allocate" << std::endl;
+            return 1;
+        }
+    }
+
+    const bool mctsOk = checkMctsZeroBudget();
+    std::cout << "MCTS with a 0 ms budget: " << (mctsOk ? "legal moves" : "no move") << std::endl;
+    if (!mctsOk) {
+        std::cerr << "error: MCTS must return a legal move when its budget is spent" << std::endl;
+        return 1;
+    }
+
+    const bool sudokuReplayOk = checkSudokuOverwriteReplay();
+    std::cout << "Sudoku replay with an overwritten cell: " << (sudokuReplayOk ? "in sync" : "desynchronized")
+              << std::endl;
+    if (!sudokuReplayOk) {
+        std::cerr << "error: a Sudoku session with an overwrite must replay with 0 rejected actions" << std::endl;
+        return 1;
+    }
+
+    bench::Suite suite;
+    addGridBenchmarks(suite);
+    add2048Benchmarks(suite);
+    addSudokuBenchmarks(suite);
+    addTicTacToeBenchmarks(suite);
+    addScoreBoardBenchmarks(suite, textFile, binaryFile);
+    addFactoryBenchmarks(suite, factory);
+
+    const auto results = suite.runAll(options);
+    std::remove(textFile.c_str());
+    std::remove(binaryFile.c_str());
+
+    if (!options.jsonFile.empty()) {
+        if (!bench::Suite::writeJson(options.jsonFile, results, options)) {
+            return 1;
+        }
+        std::cout << "Wrote " << options.jsonFile << std::endl;
+    }
+    return 0;
+}
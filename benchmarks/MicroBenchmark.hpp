@@ -0,0 +1,219 @@
+#ifndef MICRO_BENCHMARK_HPP
+#define MICRO_BENCHMARK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * Minimal Google-Benchmark-style harness
+ * A benchmark is a function that runs its body `iterations` times. The
+ * harness grows the iteration count until one run takes at least the
+ * minimum time, then times several repetitions and reports the median
+ * nanoseconds per iteration. Results can be written as JSON in the layout
+ * Google Benchmark uses ({"context": ..., "benchmarks": [...]}) so existing
+ * comparison scripts work on it.
+ */
+namespace bench {
+
+/**
+ * Keep a value alive so the computation producing it is not optimized away
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/**
+ * Prevent the compiler from caching memory across this point
+ */
+inline void clobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+using Body = std::function<void(std::uint64_t iterations)>;
+
+struct Benchmark {
+    std::string name;
+    Body body;
+};
+
+struct Result {
+    std::string name;
+    std::uint64_t iterations = 0;
+    double nsPerIteration = 0.0;   // Median of the repetitions
+    double minNs = 0.0;
+    double maxNs = 0.0;
+};
+
+struct Options {
+    std::string filter;            // Substring of the names to run (empty: all)
+    std::string jsonFile;          // Write JSON results here (empty: none)
+    double minTimeSeconds = 0.1;   // Shortest timed run
+    int repetitions = 5;
+};
+
+/**
+ * Registry and runner
+ */
+class Suite {
+private:
+    std::vector<Benchmark> benchmarks;
+
+    static double timeRun(const Body& body, std::uint64_t iterations) {
+        const auto start = std::chrono::steady_clock::now();
+        body(iterations);
+        clobberMemory();
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static std::string escape(const std::string& text) {
+        std::string out;
+        for (char ch : text) {
+            if (ch == '"' || ch == '\\') out += '\\';
+            out += ch;
+        }
+        return out;
+    }
+
+public:
+    void add(std::string name, Body body) {
+        benchmarks.push_back({std::move(name), std::move(body)});
+    }
+
+    Result run(const Benchmark& benchmark, const Options& options) const {
+        // Calibrate: grow the iteration count until a run reaches the minimum time
+        std::uint64_t iterations = 1;
+        while (true) {
+            const double seconds = timeRun(benchmark.body, iterations);
+            if (seconds >= options.minTimeSeconds || iterations >= (1ull << 40)) {
+                break;
+            }
+            const double scale = seconds > 0 ? options.minTimeSeconds * 1.4 / seconds : 100.0;
+            iterations = static_cast<std::uint64_t>(iterations * std::min(100.0, std::max(2.0, scale)));
+        }
+
+        std::vector<double> samples;
+        for (int rep = 0; rep < std::max(1, options.repetitions); ++rep) {
+            samples.push_back(timeRun(benchmark.body, iterations) * 1e9 / iterations);
+        }
+        std::sort(samples.begin(), samples.end());
+
+        Result result;
+        result.name = benchmark.name;
+        result.iterations = iterations;
+        result.nsPerIteration = samples[samples.size() / 2];
+        result.minNs = samples.front();
+        result.maxNs = samples.back();
+        return result;
+    }
+
+    std::vector<Result> runAll(const Options& options) const {
+        std::vector<Result> results;
+        std::cout << std::left << std::setw(44) << "Benchmark" << std::right << std::setw(14) << "ns/iter"
+                  << std::setw(14) << "min" << std::setw(14) << "max" << std::setw(14) << "iterations" << "\n";
+        std::cout << std::string(100, '-') << "\n";
+        for (const Benchmark& benchmark : benchmarks) {
+            if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+            const Result result = run(benchmark, options);
+            std::cout << std::left << std::setw(44) << result.name << std::right << std::fixed << std::setprecision(2)
+                      << std::setw(14) << result.nsPerIteration << std::setw(14) << result.minNs
+                      << std::setw(14) << result.maxNs << std::setw(14) << result.iterations << std::endl;
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    static bool writeJson(const std::string& filename, const std::vector<Result>& results, const Options& options) {
+        std::ofstream out(filename, std::ios::trunc);
+        if (!out.is_open()) {
+            std::cerr << "Unable to open file: " << filename << std::endl;
+            return false;
+        }
+
+        char date[32] = "";
+        const std::time_t now = std::time(nullptr);
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+#ifdef NDEBUG
+        const char* buildType = "release";
+#else
+        const char* buildType = "debug";
+#endif
+
+        out << "{\n  \"context\": {\n"
+            << "    \"date\": \"" << date << "\",\n"
+            << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+            << "    \"library_build_type\": \"" << buildType << "\",\n"
+            << "    \"min_time\": " << options.minTimeSeconds << ",\n"
+            << "    \"repetitions\": " << options.repetitions << "\n"
+            << "  },\n  \"benchmarks\": [\n";
+        out << std::fixed << std::setprecision(3);
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            out << "    {\n"
+                << "      \"name\": \"" << escape(result.name) << "\",\n"
+                << "      \"run_type\": \"aggregate\",\n"
+                << "      \"aggregate_name\": \"median\",\n"
+                << "      \"iterations\": " << result.iterations << ",\n"
+                << "      \"real_time\": " << result.nsPerIteration << ",\n"
+                << "      \"min_time\": " << result.minNs << ",\n"
+                << "      \"max_time\": " << result.maxNs << ",\n"
+                << "      \"time_unit\": \"ns\"\n"
+                << "    }" << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+};
+
+/**
+ * Parse --filter=, --json=, --min-time= and --repetitions=
+ * @return false (after printing usage) on an unknown argument
+ */
+inline bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const auto value = [&arg](const char* prefix) -> const char* {
+            const size_t length = std::strlen(prefix);
+            return arg.compare(0, length, prefix) == 0 ? arg.c_str() + length : nullptr;
+        };
+        if (const char* v = value("--filter=")) {
+            options.filter = v;
+        } else if (const char* v = value("--json=")) {
+            options.jsonFile = v;
+        } else if (const char* v = value("--min-time=")) {
+            options.minTimeSeconds = std::max(0.001, std::atof(v));
+        } else if (const char* v = value("--repetitions=")) {
+            options.repetitions = std::max(1, std::atoi(v));
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter=SUBSTRING] [--json=FILE] [--min-time=SECONDS] [--repetitions=N]\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace bench
+
+#endif // MICRO_BENCHMARK_HPP
@@ -0,0 +1,125 @@
+#include "ai/SudokuSolver.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Sudoku solver benchmark
+ * Solves a puzzle set with each backend (verifying uniqueness with a
+ * solution limit of 2) and reports puzzles/second.
+ *
+ * Usage: SudokuSolverBenchmark [puzzle_file] [repeat]
+ * The file holds one 81-character puzzle per line ('.' or '0' for empty),
+ * e.g. the top95 / top1465 / 17-clue sets. Without a file a built-in set of
+ * well-known hard puzzles is used.
+ */
+
+namespace {
+const char* BuiltinHardPuzzles[] = {
+    // Arto Inkala (2012)
+    "8..........36......7..9.2...5...7.......457.....1...3...1....68..85...1..9....4..",
+    // AI Escargot
+    "1....7.9..3..2...8..96..5....53..9...1..8...26....4...3......1..4......7..7...3..",
+    // Arto Inkala (2006)
+    "..53.....8......2..7..1.5..4....53...1..7...6..32...8..6.5....9..4....3......97..",
+    // Easter Monster
+    "1.......2.9.4...5...6...7...5.9.3.......7.......85..4.7.....6...3...9.8...2.....1",
+    // Other well-known hard puzzles
+    "85...24..72......9..4.........1.7..23.5...9...4...........8..7..17..........36.4.",
+    "4.....8.5.3..........7......2.....6.....8.4......1.......6.3.7.5..2.....1.4......",
+    "52...6.........7.13...........4..8..6......5...........418.........3..2...87.....",
+    "6.....8.3.4.7.................5.4.7.3..2.....1.6.......2.....5.....8.6......1....",
+    "48.3............71.2.......7.5....6....2..8.............1.76...3.....4......5....",
+};
+
+bool isValidSolution(const SudokuSolver::Puzzle& puzzle, const SudokuSolver::Puzzle& solution) {
+    for (int idx = 0; idx < 81; ++idx) {
+        if (solution[idx] < 1 || solution[idx] > 9) return false;
+        if (puzzle[idx] != 0 && puzzle[idx] != solution[idx]) return false;
+    }
+    for (int i = 0; i < 9; ++i) {
+        int rowSeen = 0, colSeen = 0, boxSeen = 0;
+        for (int j = 0; j < 9; ++j) {
+            rowSeen |= 1 << solution[i * 9 + j];
+            colSeen |= 1 << solution[j * 9 + i];
+            boxSeen |= 1 << solution[((i / 3) * 3 + j / 3) * 9 + (i % 3) * 3 + j % 3];
+        }
+        if (rowSeen != 0x3FE || colSeen != 0x3FE || boxSeen != 0x3FE) return false;
+    }
+    return true;
+}
+
+void runBackend(const char* label, SudokuSolver::Backend backend,
+                const std::vector<SudokuSolver::Puzzle>& puzzles, int repeat) {
+    SudokuSolver solver(backend);
+    int unique = 0;
+    int invalid = 0;
+    std::uint64_t guesses = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int pass = 0; pass < repeat; ++pass) {
+        const auto results = solver.solveBatch(puzzles, 2);
+        if (pass == 0) {
+            for (size_t i = 0; i < results.size(); ++i) {
+                if (results[i].solutionCount == 1) ++unique;
+                if (results[i].solutionCount == 0 || !isValidSolution(puzzles[i], results[i].solution)) ++invalid;
+                guesses += results[i].guesses;
+            }
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double solved = static_cast<double>(puzzles.size()) * repeat;
+
+    std::cout << std::fixed << std::setprecision(1)
+              << std::left << std::setw(14) << label
+              << "puzzles/s: " << std::setw(12) << (seconds > 0 ? solved / seconds : 0.0)
+              << "us/puzzle: " << std::setw(10) << (solved > 0 ? seconds * 1e6 / solved : 0.0)
+              << "unique: " << unique << "/" << puzzles.size()
+              << "  invalid: " << invalid
+              << "  guesses/puzzle: " << (puzzles.empty() ? 0.0 : double(guesses) / puzzles.size())
+              << "\n";
+}
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<SudokuSolver::Puzzle> puzzles;
+    int repeat = 200;
+
+    if (argc >= 2) {
+        std::ifstream file(argv[1]);
+        if (!file.is_open()) {
+            std::cerr << "Unable to open file: " << argv[1] << std::endl;
+            return 1;
+        }
+        std::string line;
+        SudokuSolver::Puzzle puzzle{};
+        while (std::getline(file, line)) {
+            if (SudokuSolver::parse(line, puzzle)) {
+                puzzles.push_back(puzzle);
+            }
+        }
+        repeat = 1;
+    } else {
+        for (const char* text : BuiltinHardPuzzles) {
+            SudokuSolver::Puzzle puzzle{};
+            SudokuSolver::parse(text, puzzle);
+            puzzles.push_back(puzzle);
+        }
+    }
+    if (argc >= 3) {
+        repeat = std::stoi(argv[2]);
+    }
+
+    if (puzzles.empty()) {
+        std::cerr << "No puzzles to solve" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Puzzles: " << puzzles.size() << "  repeat: " << repeat << "\n";
+    runBackend("propagation", SudokuSolver::Backend::Propagation, puzzles, repeat);
+    runBackend("dancing-links", SudokuSolver::Backend::DancingLinks, puzzles, repeat);
+    return 0;
+}
@@ -0,0 +1,291 @@
+#ifndef MCTS_SEARCH_HPP
+#define MCTS_SEARCH_HPP
+
+#include "../util/WorkStealingPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+/**
+ * How moves are picked in MCTS playouts
+ */
+enum class MctsRollout {
+    Random,     // Uniform over legal moves (fastest playouts)
+    Heuristic   // Game-specific greedy choice (stronger, slower playouts)
+};
+
+/**
+ * Generic multithreaded Monte Carlo tree search (UCT)
+ * Root parallelization: every thread grows its own tree from the root for
+ * the time budget, on a WorkStealingPool kept across searches, and the root
+ * visit counts are summed to pick the move. Trees are open-loop (nodes are
+ * action sequences and each iteration replays them on a fresh copy of the
+ * root), so chance events such as 2048 tile spawns need no chance nodes.
+ *
+ * Model supplies the game as static functions:
+ *   using State;                                  // Copyable position
+ *   legalMoves(const State&, std::vector<int>&)   // Fill with legal moves
+ *   play(State&, int move, std::mt19937&)         // Apply a move and any chance event
+ *   isTerminal(const State&)
+ *   playerToMove(const State&)                    // 0 or 1 (always 0 for one player)
+ *   reward(const State& end, const State& root, int player)  // In [0, 1]
+ *   rolloutMove(const State&, const std::vector<int>& moves, MctsRollout, std::mt19937&)
+ */
+template<typename Model>
+class MctsSearch {
+public:
+    using State = typename Model::State;
+
+    /**
+     * Search parameters
+     */
+    struct Config {
+        int timeLimitMs = 100;              // Wall-clock budget per search
+        std::uint64_t maxPlayouts = 0;      // Stop after this many playouts in total (0 = time only)
+        size_t threads = 0;                 // Trees searched in parallel (0 = one per hardware thread)
+        double exploration = 1.41421356;    // UCT exploration constant
+        MctsRollout rollout = MctsRollout::Heuristic;
+        int maxRolloutDepth = 200;          // Moves per playout before it is scored
+        size_t maxNodes = 1 << 18;          // Nodes per tree; leaves past this are only played out
+        std::uint32_t seed = 0;             // Seed of the first thread (0 = random)
+    };
+
+    /**
+     * Counters from the most recent search
+     */
+    struct SearchStats {
+        std::uint64_t playouts = 0;
+        std::uint64_t nodes = 0;
+        double elapsedMs = 0.0;
+        double playoutsPerSecond = 0.0;
+        size_t threads = 0;
+    };
+
+    /**
+     * Visits and mean reward of one root move, summed over the trees
+     */
+    struct MoveStats {
+        int move = -1;
+        std::uint64_t visits = 0;
+        double value = 0.0;
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Node {
+        int move = -1;
+        int firstChild = -1;
+        int childCount = 0;
+        int playerJustMoved = 0;
+        std::uint32_t visits = 0;
+        double value = 0.0;      // Sum of rewards for playerJustMoved
+        bool expanded = false;
+    };
+
+    Config config;
+    std::unique_ptr<WorkStealingPool> pool;   // Created on the first multithreaded search
+    SearchStats stats;
+    std::vector<MoveStats> rootStats;
+
+    /**
+     * Grow one tree until the deadline or the shared playout budget runs out
+     */
+    std::vector<MoveStats> searchTree(const State& root, std::uint32_t seed, Clock::time_point deadline,
+                                      std::atomic<std::uint64_t>& playouts, std::uint64_t& nodeCount) const {
+        std::mt19937 rng(seed);
+        std::vector<Node> tree;
+        tree.reserve(std::min<size_t>(config.maxNodes, 4096));
+        tree.emplace_back();
+        tree[0].playerJustMoved = 1 - Model::playerToMove(root);
+
+        State state = root;
+        std::vector<int> moves;
+        std::vector<int> path;
+        std::uint64_t iteration = 0;
+
+        // The first playout always runs, so every tree has root statistics
+        // even when the budget is spent before the search starts
+        while (true) {
+            const bool first = iteration == 0;
+            if (!first && (iteration & 63) == 0 && Clock::now() >= deadline) break;
+            ++iteration;
+            if (config.maxPlayouts > 0 && playouts.fetch_add(1, std::memory_order_relaxed) >= config.maxPlayouts &&
+                !first) break;
+
+            state = root;
+            int node = 0;
+            path.clear();
+            path.push_back(0);
+
+            // Selection: descend by UCT among children whose move is legal in this sample
+            while (tree[node].expanded && !Model::isTerminal(state)) {
+                Model::legalMoves(state, moves);
+                const double logVisits = std::log(static_cast<double>(tree[node].visits) + 1.0);
+                int best = -1;
+                double bestScore = -1.0;
+                for (int i = 0; i < tree[node].childCount; ++i) {
+                    const int child = tree[node].firstChild + i;
+                    if (std::find(moves.begin(), moves.end(), tree[child].move) == moves.end()) continue;
+                    const Node& n = tree[child];
+                    const double score = n.visits == 0
+                        ? 1e9 + static_cast<double>(rng() & 1023)   // Unvisited first, in random order
+                        : n.value / n.visits + config.exploration * std::sqrt(logVisits / n.visits);
+                    if (score > bestScore) {
+                        bestScore = score;
+                        best = child;
+                    }
+                }
+                if (best < 0) break;
+                Model::play(state, tree[best].move, rng);
+                node = best;
+                path.push_back(node);
+            }
+
+            // Expansion: add every legal move as a child, then step into one
+            if (!tree[node].expanded && !Model::isTerminal(state)) {
+                Model::legalMoves(state, moves);
+                if (tree.size() + moves.size() <= config.maxNodes) {
+                    const int player = Model::playerToMove(state);
+                    const int first = static_cast<int>(tree.size());
+                    for (int move : moves) {
+                        Node child;
+                        child.move = move;
+                        child.playerJustMoved = player;
+                        tree.push_back(child);
+                    }
+                    tree[node].firstChild = first;
+                    tree[node].childCount = static_cast<int>(moves.size());
+                    tree[node].expanded = true;
+                    const int child = first + static_cast<int>(rng() % moves.size());
+                    Model::play(state, tree[child].move, rng);
+                    node = child;
+                    path.push_back(node);
+                }
+            }
+
+            // Playout
+            for (int depth = 0; depth < config.maxRolloutDepth && !Model::isTerminal(state); ++depth) {
+                Model::legalMoves(state, moves);
+                if (moves.empty()) break;
+                Model::play(state, Model::rolloutMove(state, moves, config.rollout, rng), rng);
+            }
+
+            // Backpropagation
+            const double rewards[2] = {Model::reward(state, root, 0), Model::reward(state, root, 1)};
+            for (int n : path) {
+                ++tree[n].visits;
+                tree[n].value += rewards[tree[n].playerJustMoved];
+            }
+        }
+
+        nodeCount = tree.size();
+        std::vector<MoveStats> result;
+        for (int i = 0; i < tree[0].childCount; ++i) {
+            const Node& child = tree[tree[0].firstChild + i];
+            result.push_back({child.move, child.visits, child.value});
+        }
+        return result;
+    }
+
+public:
+    /**
+     * Constructor with default search parameters
+     */
+    MctsSearch() = default;
+
+    /**
+     * Constructor
+     * @param cfg Search parameters
+     */
+    explicit MctsSearch(const Config& cfg) : config(cfg) {}
+
+    /**
+     * Pick the most visited move from a position
+     * @param root Position to search
+     * @return Best move (the first legal move if no playout finished), or -1
+     *         if the position has no legal move
+     */
+    int search(const State& root) {
+        stats = SearchStats();
+        rootStats.clear();
+        std::vector<int> moves;
+        if (!Model::isTerminal(root)) {
+            Model::legalMoves(root, moves);
+        }
+        if (moves.size() <= 1) {
+            return moves.empty() ? -1 : moves[0];   // Nothing to search
+        }
+
+        const auto start = Clock::now();
+        const auto deadline = start + std::chrono::milliseconds(config.timeLimitMs);
+        size_t threadCount = config.threads != 0 ? config.threads : std::max(1u, std::thread::hardware_concurrency());
+
+        std::random_device rd;
+        const std::uint32_t baseSeed = config.seed != 0 ? config.seed : rd();
+        std::atomic<std::uint64_t> playouts{0};
+        std::vector<std::vector<MoveStats>> results(threadCount);
+        std::vector<std::uint64_t> nodeCounts(threadCount, 0);
+
+        if (threadCount == 1) {
+            results[0] = searchTree(root, baseSeed, deadline, playouts, nodeCounts[0]);
+        } else {
+            if (!pool || pool->getThreadCount() != threadCount) {
+                pool = std::make_unique<WorkStealingPool>(threadCount);
+            }
+            for (size_t t = 0; t < threadCount; ++t) {
+                pool->submit([&, t]() {
+                    results[t] = searchTree(root, baseSeed + static_cast<std::uint32_t>(t) * 0x9E3779B9u,
+                                            deadline, playouts, nodeCounts[t]);
+                });
+            }
+            pool->wait();
+        }
+
+        // Sum the root statistics of every tree
+        for (const auto& result : results) {
+            for (const MoveStats& move : result) {
+                auto it = std::find_if(rootStats.begin(), rootStats.end(),
+                                       [&move](const MoveStats& m) { return m.move == move.move; });
+                if (it == rootStats.end()) {
+                    rootStats.push_back(move);
+                } else {
+                    it->visits += move.visits;
+                    it->value += move.value;
+                }
+            }
+        }
+
+        stats.threads = threadCount;
+        for (const MoveStats& move : rootStats) stats.playouts += move.visits;
+        for (std::uint64_t count : nodeCounts) stats.nodes += count;
+        stats.elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        stats.playoutsPerSecond = stats.elapsedMs > 0 ? stats.playouts * 1000.0 / stats.elapsedMs : 0.0;
+
+        const auto best = std::max_element(rootStats.begin(), rootStats.end(),
+            [](const MoveStats& a, const MoveStats& b) {
+                return a.visits != b.visits ? a.visits < b.visits : a.value < b.value;
+            });
+        return best == rootStats.end() ? moves[0] : best->move;
+    }
+
+    /**
+     * Get counters from the most recent search
+     */
+    const SearchStats& getLastStats() const { return stats; }
+
+    /**
+     * Get per-move root statistics from the most recent search
+     */
+    const std::vector<MoveStats>& getRootStats() const { return rootStats; }
+
+    const Config& getConfig() const { return config; }
+};
+
+#endif // MCTS_SEARCH_HPP
@@ -0,0 +1,112 @@
+#ifndef MNK_ALPHA_BETA_AI_HPP
+#define MNK_ALPHA_BETA_AI_HPP
+
+#include "TicTacToeStrategy.hpp"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Alpha-beta AI for m,n,k games of any board size (e.g. 3x3 Tic-Tac-Toe,
+ * 15x15 five-in-a-row)
+ * Iterative deepening negamax within a per-move time limit. Positions are
+ * Zobrist-hashed into a transposition table whose best move is tried first;
+ * remaining moves are ordered by how much they build and block, and only
+ * cells near existing marks are considered. The evaluation counts marks in
+ * every k-cell window and is updated incrementally on each move.
+ */
+class MnkAlphaBetaAI : public TicTacToeStrategy {
+public:
+    /**
+     * Search parameters
+     */
+    struct Config {
+        int winLength = 3;        // Marks in a row needed to win
+        int timeLimitMs = 200;    // Wall-clock budget per move
+        int maxDepth = 12;        // Deepest iteration
+        int maxCandidates = 16;   // Moves searched per node after ordering (0 = all)
+        int tableBits = 18;       // Transposition table holds 2^tableBits entries
+    };
+
+    /**
+     * Counters from the most recent search
+     */
+    struct SearchStats {
+        std::uint64_t nodes = 0;
+        std::uint64_t tableHits = 0;
+        int completedDepth = 0;
+        std::int64_t score = 0;   // From the mover's perspective
+    };
+
+private:
+    enum class Bound : std::uint8_t { Exact, Lower, Upper };
+
+    struct TableEntry {
+        std::uint64_t key = 0;
+        std::int64_t score = 0;
+        std::int32_t move = -1;
+        std::int16_t depth = -1;
+        Bound bound = Bound::Exact;
+    };
+
+    Config config;
+
+    // Board geometry, rebuilt when the board size changes
+    int rows = 0;
+    int cols = 0;
+    std::vector<std::uint64_t> zobrist;        // Key per (cell, player)
+    std::uint64_t sideKey = 0;
+    std::vector<int> cellWindows;              // Ids of the k-cell windows through each cell
+    std::vector<int> cellWindowStart;          // Offsets into cellWindows (one past the end for the last cell)
+    std::vector<int> nearbyCells;              // Cells within two steps of each cell
+    std::vector<int> nearbyStart;
+    std::vector<std::int64_t> weights;         // Window value by mark count
+
+    // Search state
+    std::vector<std::int8_t> cells;            // -1 empty, 0 X, 1 O
+    std::array<std::vector<std::uint8_t>, 2> windowCount;
+    std::vector<std::uint8_t> nearbyMarks;     // Marks within two steps of each cell
+    std::int64_t evaluation = 0;               // From X's perspective
+    std::uint64_t hash = 0;
+    int marks = 0;
+    std::vector<TableEntry> table;
+    std::vector<std::vector<int>> moveBuffers; // Candidate list per ply
+    std::chrono::steady_clock::time_point deadline;
+    bool aborted = false;
+    SearchStats stats;
+
+    void setupGeometry(int r, int c);
+    std::int64_t placeGain(int cell, int player) const;
+    bool place(int cell, int player);
+    void unplace(int cell, int player);
+    void generateMoves(int player, int firstMove, std::vector<int>& out) const;
+    std::int64_t negamax(int depth, std::int64_t alpha, std::int64_t beta, int player, int ply);
+
+public:
+    /**
+     * Constructor with default search parameters
+     */
+    MnkAlphaBetaAI();
+
+    /**
+     * Constructor
+     * @param cfg Search parameters
+     */
+    explicit MnkAlphaBetaAI(const Config& cfg);
+
+    /**
+     * Choose the best move found within the time limit
+     * @param board Current board
+     * @param symbol Player to move (X or O)
+     * @return Cell index row * cols + col, or -1 if the board is full
+     */
+    int chooseMove(const Grid<char>& board, char symbol) override;
+
+    /**
+     * Get counters from the most recent search
+     */
+    const SearchStats& getLastStats() const { return stats; }
+};
+
+#endif // MNK_ALPHA_BETA_AI_HPP
@@ -0,0 +1,97 @@
+#ifndef PUZZLE_2048_EXPECTIMAX_AI_HPP
+#define PUZZLE_2048_EXPECTIMAX_AI_HPP
+
+#include "MoveStrategy.hpp"
+#include "../games/Board2048.hpp"
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+/**
+ * Expectimax AI strategy for 2048
+ * Maximizes over the four moves and averages over every 2/4 tile spawn
+ * (90% / 10%, matching Puzzle2048Game::spawnTile). Unlikely spawn chains are
+ * pruned by a probability cutoff and repeated positions are served from a
+ * hash-keyed transposition cache.
+ */
+class Puzzle2048ExpectimaxAI : public MoveStrategy<Board2048> {
+public:
+    /**
+     * Search parameters
+     */
+    struct Config {
+        int depth = 2;                     // Spawn/move layers searched below each candidate move
+        float probabilityCutoff = 0.0001f; // Chance branches below this are evaluated directly
+        int cacheBits = 16;                // Cache holds 2^cacheBits entries (0 disables it)
+    };
+
+    /**
+     * Counters from the most recent search
+     */
+    struct SearchStats {
+        std::uint64_t nodes = 0;
+        std::uint64_t cacheHits = 0;
+    };
+
+private:
+    struct CacheEntry {
+        Board2048::Bits board = 0;
+        float score = 0.f;
+        int depth = 0;
+        std::uint32_t generation = 0;
+    };
+
+    Config config;
+    std::vector<CacheEntry> cache;
+    std::uint32_t generation = 0;
+    int cacheShift = 64;
+    SearchStats stats;
+
+    /**
+     * Score the best move from a position (player's turn)
+     */
+    float scoreMoveNode(Board2048::Bits board, float probability, int depth);
+
+    /**
+     * Score the expected value over all tile spawns (random turn)
+     */
+    float scoreChanceNode(Board2048::Bits board, float probability, int depth);
+
+    /**
+     * Static evaluation of a position
+     */
+    static float evaluate(Board2048::Bits board);
+
+public:
+    /**
+     * Constructor with default search parameters
+     */
+    Puzzle2048ExpectimaxAI();
+
+    /**
+     * Constructor
+     * @param cfg Search parameters
+     */
+    explicit Puzzle2048ExpectimaxAI(const Config& cfg);
+
+    /**
+     * Pick the best move for a position
+     * @param board Board to analyse
+     * @return Best direction, or std::nullopt if no move is possible
+     */
+    std::optional<Board2048::Direction> chooseMove(const Board2048& board);
+
+    /**
+     * Apply the best move to the board (no tile is spawned)
+     * @param board Reference to game board
+     * @param symbol Unused for 2048
+     */
+    void makeMove(Board2048& board, char symbol) override;
+
+    /**
+     * Get counters from the most recent search
+     */
+    const SearchStats& getLastStats() const { return stats; }
+};
+
+#endif // PUZZLE_2048_EXPECTIMAX_AI_HPP
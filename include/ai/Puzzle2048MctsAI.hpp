@@ -0,0 +1,73 @@
+#ifndef PUZZLE_2048_MCTS_AI_HPP
+#define PUZZLE_2048_MCTS_AI_HPP
+
+#include "MoveStrategy.hpp"
+#include "MctsSearch.hpp"
+#include "../games/Board2048.hpp"
+#include <optional>
+
+/**
+ * Monte Carlo tree search AI for 2048
+ * Playouts spawn 2/4 tiles at random (90% / 10%) and are scored by the
+ * points gained over the root position. Heuristic playouts pick the move
+ * that leaves the most empty cells.
+ */
+class Puzzle2048MctsAI : public MoveStrategy<Board2048> {
+public:
+    /**
+     * 2048 rules for MctsSearch (moves are Board2048::Direction values)
+     */
+    struct Model {
+        struct State {
+            Board2048 board;
+            int score = 0;
+        };
+
+        static void legalMoves(const State& state, std::vector<int>& moves);
+        static void play(State& state, int move, std::mt19937& rng);
+        static bool isTerminal(const State& state) { return !state.board.canMove(); }
+        static int playerToMove(const State& /*state*/) { return 0; }
+        static double reward(const State& end, const State& root, int player);
+        static int rolloutMove(const State& state, const std::vector<int>& moves, MctsRollout policy,
+                               std::mt19937& rng);
+    };
+
+    using Search = MctsSearch<Model>;
+    using Config = Search::Config;
+
+private:
+    Search search;
+
+public:
+    /**
+     * Constructor with default search parameters
+     */
+    Puzzle2048MctsAI() = default;
+
+    /**
+     * Constructor
+     * @param cfg Search parameters
+     */
+    explicit Puzzle2048MctsAI(const Config& cfg) : search(cfg) {}
+
+    /**
+     * Pick the most visited move after the time budget
+     * @param board Board to analyse
+     * @return Best direction, or std::nullopt if no move is possible
+     */
+    std::optional<Board2048::Direction> chooseMove(const Board2048& board);
+
+    /**
+     * Apply the best move to the board (no tile is spawned)
+     * @param board Reference to game board
+     * @param symbol Unused for 2048
+     */
+    void makeMove(Board2048& board, char symbol) override;
+
+    /**
+     * Get playout counters from the most recent search
+     */
+    const Search::SearchStats& getLastStats() const { return search.getLastStats(); }
+};
+
+#endif // PUZZLE_2048_MCTS_AI_HPP
@@ -0,0 +1,77 @@
+#ifndef SUDOKU_GENERATOR_HPP
+#define SUDOKU_GENERATOR_HPP
+
+#include "SudokuSolver.hpp"
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+class WorkStealingPool;
+
+/**
+ * Sudoku puzzle generator
+ * Builds a random solved grid by completing three randomly filled diagonal
+ * boxes and applying validity-preserving symmetries (digit relabelling,
+ * row/column swaps within bands and stacks, band/stack swaps, transpose),
+ * then removes clues in random order as long as the puzzle keeps a unique
+ * solution. Each result is graded by SudokuSolver.
+ */
+class SudokuGenerator {
+public:
+    using Puzzle = SudokuSolver::Puzzle;
+    using Difficulty = SudokuSolver::Difficulty;
+
+    /**
+     * A generated, graded puzzle
+     */
+    struct GeneratedPuzzle {
+        Puzzle puzzle{};
+        Difficulty difficulty = Difficulty::Easy;
+        int clues = 81;
+    };
+
+    /**
+     * Options for filling a bank in parallel
+     */
+    struct BatchConfig {
+        std::array<size_t, SudokuSolver::DifficultyCount> targets{};  // Puzzles wanted per difficulty
+        std::uint64_t seed = 1;
+        size_t maxAttempts = 100000;  // Give up on unfilled difficulties after this many puzzles
+    };
+
+private:
+    std::mt19937_64 rng;
+    SudokuSolver solver;
+
+    /**
+     * Build a random solved grid
+     */
+    Puzzle randomSolution();
+
+public:
+    /**
+     * Constructor
+     * @param seed Random seed; equal seeds generate equal puzzles
+     */
+    explicit SudokuGenerator(std::uint64_t seed);
+
+    /**
+     * Generate one puzzle
+     * @param minClues Stop removing clues at this count (17 digs as far as uniqueness allows)
+     * @return Generated puzzle and its grade
+     */
+    GeneratedPuzzle generate(int minClues = 17);
+
+    /**
+     * Generate puzzles on a thread pool until every difficulty has its target
+     * Attempt i always uses seed + i, so the output depends only on the config.
+     * @param config Targets and seed
+     * @param pool Pool to run on
+     * @return Puzzles indexed by difficulty (short if maxAttempts was reached)
+     */
+    static std::array<std::vector<Puzzle>, SudokuSolver::DifficultyCount>
+    generateBatch(const BatchConfig& config, WorkStealingPool& pool);
+};
+
+#endif // SUDOKU_GENERATOR_HPP
@@ -0,0 +1,131 @@
+#ifndef SUDOKU_SOLVER_HPP
+#define SUDOKU_SOLVER_HPP
+
+#include "../core/Grid.hpp"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Sudoku solver with two interchangeable backends
+ * - Propagation: bitmask naked/hidden singles plus backtracking on the
+ *   cell with the fewest candidates (minimum remaining values)
+ * - DancingLinks: Knuth's Algorithm X over the 324-column exact cover matrix
+ * Both can count solutions up to a limit, which is how uniqueness is verified.
+ */
+class SudokuSolver {
+public:
+    /**
+     * Flat 81-cell puzzle in row-major order (0 = empty, 1-9 = digit)
+     */
+    using Puzzle = std::array<std::uint8_t, 81>;
+
+    /**
+     * Solving algorithm
+     */
+    enum class Backend { Propagation, DancingLinks };
+
+    /**
+     * Difficulty grade, by the techniques a human solver needs
+     * - Easy: naked singles only
+     * - Medium: naked and hidden singles
+     * - Hard: singles plus at most HardGuessLimit guesses
+     * - Expert: anything harder
+     */
+    enum class Difficulty { Easy, Medium, Hard, Expert };
+    static constexpr int DifficultyCount = 4;
+    static constexpr std::uint64_t HardGuessLimit = 6;
+
+    /**
+     * Outcome of a solve
+     */
+    struct Result {
+        int solutionCount = 0;        // Solutions found, capped at the requested limit
+        Puzzle solution{};            // First solution found (valid if solutionCount > 0)
+        std::uint64_t guesses = 0;    // Branches taken beyond forced moves
+    };
+
+private:
+    class DancingLinks;
+
+    Backend backend;
+    std::unique_ptr<DancingLinks> dlx;  // Exact cover matrix, built once and reused
+
+public:
+    /**
+     * Constructor
+     * @param b Backend to use
+     */
+    explicit SudokuSolver(Backend b = Backend::Propagation);
+    ~SudokuSolver();
+
+    SudokuSolver(SudokuSolver&&) noexcept;
+    SudokuSolver& operator=(SudokuSolver&&) noexcept;
+
+    /**
+     * Solve a puzzle
+     * @param puzzle Puzzle to solve
+     * @param solutionLimit Stop after this many solutions (2 verifies uniqueness)
+     * @return Solve result
+     */
+    Result solve(const Puzzle& puzzle, int solutionLimit = 1);
+
+    /**
+     * Check that a puzzle has exactly one solution
+     * @param puzzle Puzzle to check
+     * @return true if unique
+     */
+    bool hasUniqueSolution(const Puzzle& puzzle);
+
+    /**
+     * Solve many puzzles in sequence
+     * @param puzzles Puzzles to solve
+     * @param solutionLimit Solution limit applied to each puzzle
+     * @return One result per puzzle
+     */
+    std::vector<Result> solveBatch(const std::vector<Puzzle>& puzzles, int solutionLimit = 1);
+
+    /**
+     * Get the backend in use
+     */
+    Backend getBackend() const { return backend; }
+
+    /**
+     * Grade a puzzle by the solving techniques it requires
+     * Always uses bitmask propagation, whatever the backend.
+     * @param puzzle Puzzle to grade (assumed to have a unique solution)
+     * @return Difficulty grade
+     */
+    static Difficulty grade(const Puzzle& puzzle);
+
+    /**
+     * Get display name of a difficulty
+     */
+    static const char* difficultyName(Difficulty difficulty);
+
+    /**
+     * Parse an 81-character puzzle line ('.' or '0' for empty cells)
+     * @param text Puzzle text; characters other than digits and '.' are ignored
+     * @param out Receives the puzzle
+     * @return true if exactly 81 cells were read
+     */
+    static bool parse(const std::string& text, Puzzle& out);
+
+    /**
+     * Format a puzzle as an 81-character line ('.' for empty cells)
+     * @param puzzle Puzzle to format
+     * @return Puzzle text
+     */
+    static std::string format(const Puzzle& puzzle);
+
+    /**
+     * Copy a 9x9 board into a flat puzzle
+     * @param board Board with 0 for empty cells
+     * @return Puzzle
+     */
+    static Puzzle fromGrid(const Grid<int, 9, 9>& board);
+};
+
+#endif // SUDOKU_SOLVER_HPP
@@ -0,0 +1,76 @@
+#ifndef TIC_TAC_TOE_MCTS_AI_HPP
+#define TIC_TAC_TOE_MCTS_AI_HPP
+
+#include "TicTacToeStrategy.hpp"
+#include "MctsSearch.hpp"
+
+/**
+ * Monte Carlo tree search AI for m,n,k games of any board size
+ * Searches on every core for a fixed time; wins count 1, draws 0.5.
+ * Heuristic playouts take a winning cell or block the opponent's, looking
+ * only along the lines through each player's last mark.
+ */
+class TicTacToeMctsAI : public TicTacToeStrategy {
+public:
+    /**
+     * m,n,k rules for MctsSearch
+     */
+    struct Model {
+        struct State {
+            Grid<char> board;
+            int winLength = 3;
+            int empty = 0;
+            char toMove = 'X';
+            char winner = ' ';
+            int lastMove[2] = {-1, -1};   // Last cell marked by X and by O
+        };
+
+        static void legalMoves(const State& state, std::vector<int>& moves);
+        static void play(State& state, int move, std::mt19937& rng);
+        static bool isTerminal(const State& state) { return state.winner != ' ' || state.empty == 0; }
+        static int playerToMove(const State& state) { return state.toMove == 'X' ? 0 : 1; }
+        static double reward(const State& end, const State& root, int player);
+        static int rolloutMove(const State& state, const std::vector<int>& moves, MctsRollout policy,
+                               std::mt19937& rng);
+    };
+
+    using Search = MctsSearch<Model>;
+
+    /**
+     * Search parameters
+     */
+    struct Config : Search::Config {
+        int winLength = 3;        // Marks in a row needed to win
+    };
+
+private:
+    int winLength;
+    Search search;
+
+public:
+    /**
+     * Constructor with default search parameters
+     */
+    TicTacToeMctsAI();
+
+    /**
+     * Constructor
+     * @param cfg Search parameters
+     */
+    explicit TicTacToeMctsAI(const Config& cfg);
+
+    /**
+     * Choose the most visited move after the time budget
+     * @param board Current board
+     * @param symbol Player to move (X or O)
+     * @return Cell index row * cols + col, or -1 if the board is full
+     */
+    int chooseMove(const Grid<char>& board, char symbol) override;
+
+    /**
+     * Get playout counters from the most recent search
+     */
+    const Search::SearchStats& getLastStats() const { return search.getLastStats(); }
+};
+
+#endif // TIC_TAC_TOE_MCTS_AI_HPP
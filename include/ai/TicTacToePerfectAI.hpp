@@ -0,0 +1,39 @@
+#ifndef TIC_TAC_TOE_PERFECT_AI_HPP
+#define TIC_TAC_TOE_PERFECT_AI_HPP
+
+#include "TicTacToeStrategy.hpp"
+
+/**
+ * Perfect-play AI strategy for 3x3 Tic-Tac-Toe
+ * Minimax values and best moves for all 3^9 board encodings are computed at
+ * compile time, so choosing a move is a single table lookup. Among equally
+ * good moves it prefers the quickest win or the slowest loss.
+ */
+class TicTacToePerfectAI : public TicTacToeStrategy {
+public:
+    /**
+     * Find the best move for a player
+     * @param board 3x3 board (' ' = empty)
+     * @param symbol Player to move (X or O)
+     * @return Cell index row * 3 + col, or -1 if the game is over or the board is not a legal 3x3 position
+     */
+    static int bestMove(const Grid<char>& board, char symbol);
+
+    /**
+     * Outcome with perfect play from both sides
+     * @param board 3x3 board (' ' = empty)
+     * @param symbol Player to move (X or O)
+     * @return 1 = symbol wins, 0 = draw, -1 = symbol loses
+     */
+    static int outcome(const Grid<char>& board, char symbol);
+
+    /**
+     * Choose the best move
+     * @param board Current board
+     * @param symbol Player symbol (X or O)
+     * @return Cell index, or -1 (see bestMove)
+     */
+    int chooseMove(const Grid<char>& board, char symbol) override;
+};
+
+#endif // TIC_TAC_TOE_PERFECT_AI_HPP
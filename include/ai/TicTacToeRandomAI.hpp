@@ -1,21 +1,32 @@
 #ifndef TIC_TAC_TOE_RANDOM_AI_HPP
 #define TIC_TAC_TOE_RANDOM_AI_HPP
 
-#include "MoveStrategy.hpp"
-#include "../core/Grid.hpp"
+#include "TicTacToeStrategy.hpp"
+#include "../util/Pcg32.hpp"
 
 /**
  * Random AI strategy for Tic-Tac-Toe
- * Makes random valid moves
+ * Makes random valid moves, drawn from a generator owned by the caller
+ * (the engine's session rng, so games replay from their seed)
  */
-class TicTacToeRandomAI : public MoveStrategy<Grid<char>> {
+class TicTacToeRandomAI : public TicTacToeStrategy {
+private:
+    Pcg32& rng;
+
 public:
     /**
-     * Make a random valid move
-     * @param board Reference to game board
+     * Constructor
+     * @param generator Random source; must outlive the strategy
+     */
+    explicit TicTacToeRandomAI(Pcg32& generator) : rng(generator) {}
+
+    /**
+     * Choose a random empty cell
+     * @param board Current board
      * @param symbol Player symbol (X or O)
+     * @return Cell index, or -1 if the board is full
      */
-    void makeMove(Grid<char>& board, char symbol) override;
+    int chooseMove(const Grid<char>& board, char symbol) override;
 };
 
 #endif // TIC_TAC_TOE_RANDOM_AI_HPP
@@ -0,0 +1,35 @@
+#ifndef TIC_TAC_TOE_STRATEGY_HPP
+#define TIC_TAC_TOE_STRATEGY_HPP
+
+#include "MoveStrategy.hpp"
+#include "../core/Grid.hpp"
+
+/**
+ * Base strategy for m,n,k games on Grid<char> (' ' = empty)
+ * Strategies pick a cell; makeMove places the mark. Exposing the chosen
+ * cell lets the game check for a win from the last move only.
+ */
+class TicTacToeStrategy : public MoveStrategy<Grid<char>> {
+public:
+    /**
+     * Choose a move
+     * @param board Current board
+     * @param symbol Player to move (X or O)
+     * @return Cell index row * cols + col, or -1 if there is no move
+     */
+    virtual int chooseMove(const Grid<char>& board, char symbol) = 0;
+
+    /**
+     * Place the chosen move on the board
+     * @param board Reference to game board
+     * @param symbol Player symbol (X or O)
+     */
+    void makeMove(Grid<char>& board, char symbol) override {
+        const int cell = chooseMove(board, symbol);
+        if (cell >= 0) {
+            board.at(cell / board.getCols(), cell % board.getCols()) = symbol;
+        }
+    }
+};
+
+#endif // TIC_TAC_TOE_STRATEGY_HPP
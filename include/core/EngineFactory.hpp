@@ -0,0 +1,43 @@
+#ifndef ENGINE_FACTORY_HPP
+#define ENGINE_FACTORY_HPP
+
+#include "GameEngine.hpp"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <functional>
+
+/**
+ * Factory class for creating game engines
+ * The SFML-free counterpart of GameFactory, used by headless tools
+ */
+class EngineFactory {
+public:
+    using Creator = std::function<std::unique_ptr<GameEngine>()>;
+
+private:
+    std::unordered_map<std::string, Creator> registry;
+
+public:
+    /**
+     * Register an engine creator function
+     * @param name Game name
+     * @param creator Function that creates engine instance
+     */
+    void registerEngine(const std::string& name, Creator creator);
+
+    /**
+     * Create an engine instance by name
+     * @param name Game name
+     * @return Unique pointer to engine instance
+     */
+    std::unique_ptr<GameEngine> create(const std::string& name) const;
+
+    /**
+     * Get list of all registered game names
+     * @return Vector of game names
+     */
+    std::vector<std::string> getGameNames() const;
+};
+
+#endif // ENGINE_FACTORY_HPP
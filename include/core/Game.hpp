@@ -1,15 +1,24 @@
 #ifndef GAME_HPP
 #define GAME_HPP
 
+#include "GameEngine.hpp"
+#include "../util/FixedTimestep.hpp"
 #include <SFML/Graphics.hpp>
+#include <limits>
 #include <string>
+#include <vector>
 
 /**
  * Abstract base class for all games
- * Defines the interface that all game implementations must follow
+ * Defines the interface that all game implementations must follow. A game
+ * is an SFML view over a GameEngine: it turns input events into engine
+ * moves and draws the engine state, while the rules live in the engine.
  */
 class Game {
 public:
+    static constexpr float NoDeadline = std::numeric_limits<float>::infinity();
+    static constexpr float UpdateStep = FixedTimestep::DefaultStep;   // Seconds per update() call
+
     virtual ~Game() = default;
     
     /**
@@ -32,21 +41,69 @@ public:
     
     /**
      * Update game logic
-     * @param dt Delta time in seconds
+     * Called on a fixed timestep, independent of the frame rate.
+     * @param dt Delta time in seconds (UpdateStep)
      */
     virtual void update(float dt) = 0;
     
     /**
      * Render the game
+     * Animations are drawn at their timers plus alpha * UpdateStep, so they
+     * move smoothly at frame rates above the update rate.
      * @param window Reference to render window
+     * @param alpha Fraction of a step elapsed since the last update, in [0, 1)
+     */
+    virtual void render(sf::RenderWindow& window, float alpha) = 0;
+    
+    /**
+     * Check if the game changed on its own since it was last rendered
+     * The game loop always redraws after input; between events it renders
+     * only when this is true (e.g. while something pulses or fades).
+     * @return true if a new frame must be drawn
+     */
+    virtual bool needsRedraw() const { return true; }
+    
+    /**
+     * Get the time until the game next changes without input
+     * @return Seconds until the next animation step; 0 while animating
+     *         every frame, NoDeadline if only input changes the game
      */
-    virtual void render(sf::RenderWindow& window) = 0;
+    virtual float getNextDeadline() const { return 0.f; }
     
     /**
      * Check if game is over
      * @return true if game is finished
      */
     virtual bool isOver() const = 0;
+    
+    /**
+     * Get the engine holding the game state and rules
+     * @return Reference to engine
+     */
+    virtual GameEngine& getEngine() = 0;
+    virtual const GameEngine& getEngine() const = 0;
+    
+    /**
+     * Get the moves currently available to the player
+     * Actions are game-specific integer codes, so headless runners and
+     * bots can drive a game without input events or a window
+     * @return Vector of legal action codes (empty if none)
+     */
+    virtual std::vector<int> getLegalActions() const { return getEngine().getLegalActions(); }
+    
+    /**
+     * Apply a move directly, bypassing input handling
+     * @param action Game-specific action code
+     * @return true if the action was legal and applied
+     */
+    virtual bool applyAction(int action) { return getEngine().applyAction(action); }
+    
+    /**
+     * Check if the game has reached a result
+     * Unlike isOver(), this ignores the on-screen result delay
+     * @return true if the game has been won, lost or drawn
+     */
+    virtual bool isFinished() const { return getEngine().isFinished(); }
 };
 
 #endif // GAME_HPP
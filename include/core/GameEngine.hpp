@@ -0,0 +1,137 @@
+#ifndef GAME_ENGINE_HPP
+#define GAME_ENGINE_HPP
+
+#include <cstdint>
+#include "../util/Pcg32.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+struct Replay;
+
+/**
+ * Abstract base class for game-state engines
+ * An engine owns the rules and state of one game and nothing else: no
+ * window, input events, fonts or timers. Engines build into the SFML-free
+ * GameStudioCore library, so simulators, benchmarks and servers can play
+ * games without a graphics stack; the SFML Game classes are views over one.
+ *
+ * Every game is reproducible from its seed and action stream: randomness
+ * comes only from the per-instance rng, seeded by beginSession(), and each
+ * accepted action (player input and AI replies alike) is passed to
+ * recordAction(), which appends it to an attached Replay.
+ */
+class GameEngine {
+private:
+    std::uint64_t version = 0;
+    std::uint32_t seed = 0;
+    std::optional<std::uint32_t> nextSeed;   // Set by setSeed() for the next session
+    Replay* recording = nullptr;
+    bool replaying = false;
+
+public:
+    using Rng = Pcg32;
+
+protected:
+    Rng rng;   // Source of all game randomness (tile spawns, puzzle picks, random AI)
+
+    /**
+     * Record a state change (views redraw when the version moves)
+     */
+    void touch() { ++version; }
+
+    /**
+     * Start a new session; call first in init()
+     * Seeds rng with the seed given to setSeed(), or a fresh one derived from
+     * a process-wide random seed, and restarts the attached recording with
+     * that seed and getSettings().
+     */
+    void beginSession();
+
+    /**
+     * Append an accepted action to the attached recording, if any
+     * @param action Code that applyAction() accepts to repeat the move
+     */
+    void recordAction(int action);
+
+    /**
+     * Check if actions are being fed from a replay
+     * Engines must not make moves of their own (AI replies) while replaying,
+     * since the replay already contains them.
+     */
+    bool isReplaying() const { return replaying; }
+
+public:
+    virtual ~GameEngine() = default;
+
+    /**
+     * Get the name of the game
+     * @return Game name as string
+     */
+    virtual std::string getName() const = 0;
+
+    /**
+     * Reset to the start of a new game
+     */
+    virtual void init() = 0;
+
+    /**
+     * Get the moves currently available to the player
+     * @return Vector of game-specific action codes (empty if none)
+     */
+    virtual std::vector<int> getLegalActions() const = 0;
+
+    /**
+     * Apply a move
+     * @param action Game-specific action code
+     * @return true if the action was legal and applied
+     */
+    virtual bool applyAction(int action) = 0;
+
+    /**
+     * Check if the game has been won, lost or drawn
+     * @return true if the game has a result
+     */
+    virtual bool isFinished() const = 0;
+
+    /**
+     * Get a counter that changes whenever the state changes
+     * @return State version
+     */
+    std::uint64_t getVersion() const { return version; }
+
+    /**
+     * Seed the next init() instead of drawing a fresh random seed
+     * @param value Session seed
+     */
+    void setSeed(std::uint32_t value) { nextSeed = value; }
+
+    /**
+     * Get the seed of the current session
+     */
+    std::uint32_t getSeed() const { return seed; }
+
+    /**
+     * Get options that change how init() sets up a game (e.g. difficulty)
+     * @return Engine-specific settings word (0 if the engine has none)
+     */
+    virtual std::uint32_t getSettings() const { return 0; }
+
+    /**
+     * Restore options saved by getSettings(); takes effect at the next init()
+     */
+    virtual void applySettings(std::uint32_t /*settings*/) {}
+
+    /**
+     * Record every session into a replay (nullptr stops recording)
+     * @param replay Replay to fill; must outlive the engine or be detached
+     */
+    void setRecording(Replay* replay) { recording = replay; }
+
+    /**
+     * Enable replay mode (see isReplaying())
+     */
+    void setReplaying(bool enabled) { replaying = enabled; }
+};
+
+#endif // GAME_ENGINE_HPP
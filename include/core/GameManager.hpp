@@ -2,17 +2,36 @@
 #define GAME_MANAGER_HPP
 
 #include "Game.hpp"
+#include "ReplayPlayer.hpp"
+#include "../util/FixedTimestep.hpp"
+#include "../util/Replay.hpp"
+#include "../util/ResourceCache.hpp"
+#include "../ui/TextCache.hpp"
 #include <SFML/Graphics.hpp>
 #include <memory>
 
 /**
- * Manages the current game instance and main game loop
+ * Manages the current game instance and its session in the shared window
+ * GameScreen drives the session a frame at a time: beginSession() restarts
+ * the game with recording attached, and endSession() saves the recording to
+ * ReplayFile and releases the game. runReplay() plays such a file back at
+ * any speed in its own loop.
  */
 class GameManager {
+public:
+    static constexpr const char* ReplayFile = "last_replay.gsr";
+
 private:
     std::unique_ptr<Game> currentGame;
-    sf::Font hudFont;
+    std::string currentGameName;   // Name the game is registered under
+    Replay recording;
+    ResourceCache::FontHandle hudFont;
+    TextCache hudTexts;
     bool hudFontLoaded = false;
+    bool sessionActive = false;
+    FixedTimestep timestep{Game::UpdateStep};   // Game updates run at a fixed rate
+    sf::Clock sessionClock;        // Game timer
+    int shownSecond = -1;          // Timer second on screen
 
 public:
     GameManager() = default;
@@ -20,13 +39,66 @@ public:
     /**
      * Set the current game
      * @param game Unique pointer to game instance
+     * @param name Name the game is registered under in GameFactory (stored in replays)
+     */
+    void setGame(std::unique_ptr<Game> game, const std::string& name);
+    
+    /**
+     * Restart the current game with the session recorded, and start the timer
+     */
+    void beginSession();
+    
+    /**
+     * Save the session recording to ReplayFile and release the game
+     */
+    void endSession();
+    
+    /**
+     * Handle an event for the running game
+     * @param event SFML event
+     * @param window Reference to render window
+     */
+    void handleEvent(const sf::Event& event, sf::RenderWindow& window);
+    
+    /**
+     * Update the running game in fixed steps
+     * At most FixedTimestep::DefaultMaxSteps updates run per frame; slower
+     * frames slow the animations down rather than the frame rate further.
+     * @param dt Seconds since the previous frame
+     */
+    void update(float dt);
+    
+    /**
+     * Draw the running game, interpolated between updates, and the timer
+     * @param window Reference to render window
+     */
+    void render(sf::RenderWindow& window);
+    
+    /**
+     * Check if the game or the timer changed since the last render
      */
-    void setGame(std::unique_ptr<Game> game);
+    bool needsRedraw() const;
     
     /**
-     * Run the main game loop
+     * Get the time until the game or the timer next changes without input
+     * @return Seconds, 0 while animating
+     */
+    float getNextDeadline() const;
+    
+    /**
+     * Check if the session is finished (no game, or the game is over)
+     */
+    bool isOver() const { return !currentGame || currentGame->isOver(); }
+
+    /**
+     * Play back a recorded session of the current game
+     * Input goes to the playback controls instead of the game: Space pauses,
+     * Up/Down double or halve the speed, Right steps while paused, R restarts
+     * and End jumps to the last move.
+     * @param replay Recorded session of the current game
+     * @param actionsPerSecond Initial playback speed
      */
-    void run();
+    void runReplay(const Replay& replay, float actionsPerSecond);
     
     /**
      * Get pointer to current game
@@ -35,8 +107,11 @@ public:
     Game* getCurrentGame() const { return currentGame.get(); }
 
 private:
+    void openWindow(sf::RenderWindow& window);
     void ensureHudFontLoaded();
+    float getElapsedSeconds() const { return sessionClock.getElapsedTime().asSeconds(); }
     void drawTimerHud(sf::RenderWindow& window, float elapsedSeconds);
+    void drawReplayHud(sf::RenderWindow& window, const ReplayPlayer& player, float speed, bool paused);
 };
 
 #endif // GAME_MANAGER_HPP
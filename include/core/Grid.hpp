@@ -1,21 +1,213 @@
 #ifndef GRID_HPP
 #define GRID_HPP
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
 #include <vector>
 #include <stdexcept>
+#include <type_traits>
 
 /**
- * Generic 2D grid template class
- * Provides a convenient interface for 2D board games
+ * Rows or columns of a Grid whose size is chosen at run time
+ */
+constexpr size_t DynamicExtent = 0;
+
+/**
+ * Strided view of one row or column of a grid
+ * Rows have stride 1, columns stride the column count. The view does not
+ * own its cells and is invalidated with the grid.
  */
 template<typename T>
+class GridSpan {
+private:
+    T* first;
+    size_t count;
+    size_t stride;
+
+public:
+    /**
+     * Random-access iterator stepping by the span's stride
+     * Holds the span's first cell and an index rather than a cell pointer:
+     * a column's end lies up to a whole row past the grid, and forming such
+     * a pointer is undefined behaviour. Cells are addressed only on access.
+     */
+    class Iterator {
+    private:
+        T* first;
+        size_t stride;
+        std::ptrdiff_t index;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        constexpr Iterator(T* p = nullptr, size_t s = 1, difference_type i = 0) : first(p), stride(s), index(i) {}
+
+        constexpr reference operator*() const { return first[index * difference_type(stride)]; }
+        constexpr pointer operator->() const { return &**this; }
+        constexpr reference operator[](difference_type n) const { return first[(index + n) * difference_type(stride)]; }
+        constexpr Iterator& operator++() { ++index; return *this; }
+        constexpr Iterator operator++(int) { Iterator it = *this; ++index; return it; }
+        constexpr Iterator& operator--() { --index; return *this; }
+        constexpr Iterator operator--(int) { Iterator it = *this; --index; return it; }
+        constexpr Iterator& operator+=(difference_type n) { index += n; return *this; }
+        constexpr Iterator& operator-=(difference_type n) { index -= n; return *this; }
+        constexpr Iterator operator+(difference_type n) const { Iterator it = *this; return it += n; }
+        constexpr Iterator operator-(difference_type n) const { Iterator it = *this; return it -= n; }
+        constexpr difference_type operator-(const Iterator& other) const { return index - other.index; }
+        constexpr bool operator==(const Iterator& other) const { return index == other.index; }
+        constexpr bool operator!=(const Iterator& other) const { return index != other.index; }
+        constexpr bool operator<(const Iterator& other) const { return index < other.index; }
+        constexpr bool operator>(const Iterator& other) const { return index > other.index; }
+        constexpr bool operator<=(const Iterator& other) const { return index <= other.index; }
+        constexpr bool operator>=(const Iterator& other) const { return index >= other.index; }
+    };
+
+    constexpr GridSpan(T* p, size_t n, size_t s) : first(p), count(n), stride(s) {}
+
+    /**
+     * Access the i-th cell (unchecked in release builds)
+     */
+    constexpr T& operator[](size_t i) const {
+        assert(i < count);
+        return first[i * stride];
+    }
+
+    constexpr size_t size() const { return count; }
+    constexpr Iterator begin() const { return Iterator(first, stride, 0); }
+    constexpr Iterator end() const { return Iterator(first, stride, std::ptrdiff_t(count)); }
+};
+
+/**
+ * Generic 2D grid template class
+ * Provides a convenient interface for 2D board games. With both extents
+ * given (Grid<int, 9, 9>) the cells live inline in a std::array and the
+ * dimensions are compile-time constants, so board loops can be unrolled;
+ * Grid<T> keeps its size in members and its cells on the heap, for boards
+ * sized at run time. at() always checks bounds and throws; operator()
+ * checks only in debug builds and is meant for hot loops.
+ */
+template<typename T, size_t Rows = DynamicExtent, size_t Cols = DynamicExtent>
 class Grid {
+    static_assert(Rows != DynamicExtent && Cols != DynamicExtent,
+                  "Give both extents, or neither for a run-time sized grid");
+
+private:
+    std::array<T, Rows * Cols> data;
+
+public:
+    using iterator = typename std::array<T, Rows * Cols>::iterator;
+    using const_iterator = typename std::array<T, Rows * Cols>::const_iterator;
+
+    /**
+     * Constructor
+     * @param v Initial value for all cells
+     */
+    constexpr explicit Grid(const T& v = T()) : data() {
+        reset(v);
+    }
+
+    /**
+     * Access element at position (r, c)
+     * @param r Row index
+     * @param c Column index
+     * @return Reference to element
+     */
+    constexpr T& at(size_t r, size_t c) {
+        if (r >= Rows || c >= Cols) {
+            throw std::out_of_range("Grid index out of range");
+        }
+        return data[r * Cols + c];
+    }
+
+    /**
+     * Access element at position (r, c) - const version
+     * @param r Row index
+     * @param c Column index
+     * @return Const reference to element
+     */
+    constexpr const T& at(size_t r, size_t c) const {
+        if (r >= Rows || c >= Cols) {
+            throw std::out_of_range("Grid index out of range");
+        }
+        return data[r * Cols + c];
+    }
+
+    /**
+     * Access element at position (r, c) without a bounds check in release builds
+     */
+    constexpr T& operator()(size_t r, size_t c) {
+        assert(r < Rows && c < Cols);
+        return data[r * Cols + c];
+    }
+
+    constexpr const T& operator()(size_t r, size_t c) const {
+        assert(r < Rows && c < Cols);
+        return data[r * Cols + c];
+    }
+
+    /**
+     * Get number of rows
+     * @return Number of rows
+     */
+    static constexpr size_t getRows() { return Rows; }
+
+    /**
+     * Get number of columns
+     * @return Number of columns
+     */
+    static constexpr size_t getCols() { return Cols; }
+
+    /**
+     * Reset all cells to a value
+     * @param v Value to set
+     */
+    constexpr void reset(const T& v = T()) {
+        for (T& cell : data) {
+            cell = v;
+        }
+    }
+
+    /**
+     * View one row or one column
+     */
+    constexpr GridSpan<T> row(size_t r) { assert(r < Rows); return GridSpan<T>(&data[r * Cols], Cols, 1); }
+    constexpr GridSpan<const T> row(size_t r) const { assert(r < Rows); return GridSpan<const T>(&data[r * Cols], Cols, 1); }
+    constexpr GridSpan<T> col(size_t c) { assert(c < Cols); return GridSpan<T>(&data[c], Rows, Cols); }
+    constexpr GridSpan<const T> col(size_t c) const { assert(c < Cols); return GridSpan<const T>(&data[c], Rows, Cols); }
+
+    /**
+     * Iterate over all cells in row-major order
+     */
+    constexpr iterator begin() { return data.begin(); }
+    constexpr iterator end() { return data.end(); }
+    constexpr const_iterator begin() const { return data.begin(); }
+    constexpr const_iterator end() const { return data.end(); }
+
+    constexpr bool operator==(const Grid& other) const { return data == other.data; }
+    constexpr bool operator!=(const Grid& other) const { return !(data == other.data); }
+};
+
+/**
+ * Run-time sized grid (heap storage)
+ */
+template<typename T>
+class Grid<T, DynamicExtent, DynamicExtent> {
 private:
     size_t rows;
     size_t cols;
     std::vector<T> data;
 
 public:
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
     /**
      * Constructor
      * @param r Number of rows
@@ -24,7 +216,7 @@ public:
      */
     Grid(size_t r = 0, size_t c = 0, const T& v = T())
         : rows(r), cols(c), data(r * c, v) {}
-    
+
     /**
      * Access element at position (r, c)
      * @param r Row index
@@ -37,32 +229,45 @@ public:
         }
         return data[r * cols + c];
     }
-    
+
     /**
      * Access element at position (r, c) - const version
      * @param r Row index
      * @param c Column index
-     * @return Const reference to element
+     * @return Const reference to element (or value for vector<bool>)
      */
-    const T& at(size_t r, size_t c) const {
+    typename std::vector<T>::const_reference at(size_t r, size_t c) const {
         if (r >= rows || c >= cols) {
             throw std::out_of_range("Grid index out of range");
         }
         return data[r * cols + c];
     }
-    
+
+    /**
+     * Access element at position (r, c) without a bounds check in release builds
+     */
+    auto operator()(size_t r, size_t c) -> decltype(data[0]) {
+        assert(r < rows && c < cols);
+        return data[r * cols + c];
+    }
+
+    typename std::vector<T>::const_reference operator()(size_t r, size_t c) const {
+        assert(r < rows && c < cols);
+        return data[r * cols + c];
+    }
+
     /**
      * Get number of rows
      * @return Number of rows
      */
     size_t getRows() const { return rows; }
-    
+
     /**
      * Get number of columns
      * @return Number of columns
      */
     size_t getCols() const { return cols; }
-    
+
     /**
      * Reset all cells to a value
      * @param v Value to set
@@ -70,6 +275,22 @@ public:
     void reset(const T& v = T()) {
         std::fill(data.begin(), data.end(), v);
     }
+
+    /**
+     * View one row or one column (not available for Grid<bool>)
+     */
+    GridSpan<T> row(size_t r) { assert(r < rows); return GridSpan<T>(data.data() + r * cols, cols, 1); }
+    GridSpan<const T> row(size_t r) const { assert(r < rows); return GridSpan<const T>(data.data() + r * cols, cols, 1); }
+    GridSpan<T> col(size_t c) { assert(c < cols); return GridSpan<T>(data.data() + c, rows, cols); }
+    GridSpan<const T> col(size_t c) const { assert(c < cols); return GridSpan<const T>(data.data() + c, rows, cols); }
+
+    /**
+     * Iterate over all cells in row-major order
+     */
+    iterator begin() { return data.begin(); }
+    iterator end() { return data.end(); }
+    const_iterator begin() const { return data.begin(); }
+    const_iterator end() const { return data.end(); }
 };
 
 #endif // GRID_HPP
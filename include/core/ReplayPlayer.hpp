@@ -0,0 +1,67 @@
+#ifndef REPLAY_PLAYER_HPP
+#define REPLAY_PLAYER_HPP
+
+#include "GameEngine.hpp"
+#include "../util/Replay.hpp"
+#include <functional>
+
+/**
+ * Re-executes a recorded session on an engine, one action at a time
+ * The engine is reset with the replay's settings and seed and put in
+ * replay mode, so it makes no moves of its own; callers step it as fast or
+ * as slowly as they like (headless runs go straight to the end).
+ */
+class ReplayPlayer {
+private:
+    const Replay& replay;
+    GameEngine& engine;
+    std::function<void()> reset;
+    size_t position = 0;
+    size_t rejected = 0;
+
+public:
+    /**
+     * Constructor; starts the replay (see restart())
+     * @param rec Replay to play; must outlive the player
+     * @param eng Engine of the recorded game
+     * @param init Starts a new game on the engine (default: eng.init()); views
+     *             pass their own init() so their state resets too
+     */
+    ReplayPlayer(const Replay& rec, GameEngine& eng, std::function<void()> init = nullptr);
+
+    /**
+     * Leave replay mode
+     */
+    ~ReplayPlayer();
+
+    ReplayPlayer(const ReplayPlayer&) = delete;
+    ReplayPlayer& operator=(const ReplayPlayer&) = delete;
+
+    /**
+     * Reset the engine to the start of the recorded session
+     */
+    void restart();
+
+    /**
+     * Apply the next recorded action
+     * @return false if the replay has ended
+     */
+    bool step();
+
+    /**
+     * Apply all remaining actions
+     */
+    void runToEnd();
+
+    bool isDone() const { return position >= replay.actions.size(); }
+    size_t getPosition() const { return position; }
+    size_t getLength() const { return replay.actions.size(); }
+
+    /**
+     * Get the number of actions the engine refused
+     * Non-zero means the engine no longer matches the recording (a desync).
+     */
+    size_t getRejected() const { return rejected; }
+};
+
+#endif // REPLAY_PLAYER_HPP
@@ -2,12 +2,19 @@
 #define SCREEN_HPP
 
 #include <SFML/Graphics.hpp>
+#include <limits>
+#include <string>
 
 /**
  * Abstract base class for all screens/UI states
  */
 class Screen {
 public:
+    static constexpr float NoDeadline = std::numeric_limits<float>::infinity();
+    static constexpr unsigned DefaultWidth = 800;
+    static constexpr unsigned DefaultHeight = 600;
+    static constexpr const char* DefaultTitle = "Modular Puzzle Game Studio";
+
     virtual ~Screen() = default;
     
     /**
@@ -28,6 +35,38 @@ public:
      * @param window Reference to render window
      */
     virtual void render(sf::RenderWindow& window) = 0;
+
+    /**
+     * Check if the screen changed on its own since it was last rendered
+     * The loop always redraws after input; between events it renders only
+     * when this is true. Animated screens keep the default.
+     * @return true if a new frame must be drawn
+     */
+    virtual bool needsRedraw() const { return true; }
+
+    /**
+     * Get the time until the screen next changes without input
+     * @return Seconds until the next animation step; 0 while animating
+     *         every frame, NoDeadline if only input changes the screen
+     */
+    virtual float getNextDeadline() const { return 0.f; }
+
+    /**
+     * Handle Escape before the application's default (back to the splash screen)
+     * @return true if the screen handled it
+     */
+    virtual bool handleEscape() { return false; }
+
+    /**
+     * Get the window size the screen is laid out for
+     * ScreenManager resizes the shared window when the screen becomes current.
+     */
+    virtual sf::Vector2u getWindowSize() const { return {DefaultWidth, DefaultHeight}; }
+
+    /**
+     * Get the window title while the screen is current
+     */
+    virtual std::string getWindowTitle() const { return DefaultTitle; }
 };
 
 #endif // SCREEN_HPP
@@ -6,10 +6,18 @@
 
 /**
  * Manages screen transitions and current active screen
+ * All screens, games included, share the application window. Screens
+ * usually request the next screen from their own handlers, so setScreen()
+ * only queues it; the switch happens before the next event, update or
+ * render, after the requesting screen has returned.
  */
 class ScreenManager {
 private:
     std::unique_ptr<Screen> currentScreen;
+    std::unique_ptr<Screen> pendingScreen;   // Becomes current at the next call
+    bool screenChanged = true;   // A new screen has not been rendered yet
+
+    void applyPendingScreen();
 
 public:
     ScreenManager() = default;
@@ -27,6 +35,12 @@ public:
      */
     void handleEvent(const sf::Event& event, sf::RenderWindow& window);
     
+    /**
+     * Offer Escape to the current screen
+     * @return true if the screen handled it
+     */
+    bool handleEscape();
+    
     /**
      * Update current screen
      * @param dt Delta time in seconds
@@ -35,15 +49,28 @@ public:
     
     /**
      * Render current screen
+     * After a screen change the window is first resized and retitled for it.
      * @param window Reference to render window
      */
     void render(sf::RenderWindow& window);
     
+    /**
+     * Check if the current screen must be drawn without new input
+     * @return true after a screen change or if the screen needs a redraw
+     */
+    bool needsRedraw() const;
+    
+    /**
+     * Get the time until the current screen next changes without input
+     * @return Seconds, 0 while animating, Screen::NoDeadline if idle
+     */
+    float getNextDeadline() const;
+    
     /**
      * Check if a screen is currently set
      * @return true if screen exists
      */
-    bool hasScreen() const { return currentScreen != nullptr; }
+    bool hasScreen() const { return currentScreen != nullptr || pendingScreen != nullptr; }
 };
 
 #endif // SCREEN_MANAGER_HPP
@@ -0,0 +1,144 @@
+#ifndef BOARD_2048_HPP
+#define BOARD_2048_HPP
+
+#include <cstdint>
+
+/**
+ * Packed 4x4 board for the 2048 game
+ * Each tile is stored as a 4-bit log2 exponent (0 = empty, 1 = 2, 2 = 4, ...)
+ * in a single 64-bit word; tile (r, c) occupies nibble r * 4 + c.
+ * Moves are resolved with precomputed 65536-entry row/column lookup tables,
+ * so a full board move is a handful of table reads instead of per-cell work.
+ */
+class Board2048 {
+public:
+    using Bits = std::uint64_t;
+
+    /**
+     * Direction tiles slide in
+     */
+    enum class Direction { Left, Right, Up, Down };
+
+    /**
+     * Largest storable exponent (2^15 = 32768); two such tiles do not merge
+     */
+    static constexpr int MaxExponent = 15;
+
+private:
+    Bits bits;
+
+public:
+    /**
+     * Constructor
+     * @param packed Packed board bits (empty board by default)
+     */
+    explicit Board2048(Bits packed = 0) : bits(packed) {}
+
+    /**
+     * Get the packed board bits
+     * @return 64-bit packed board
+     */
+    Bits raw() const { return bits; }
+
+    /**
+     * Get tile exponent at position (r, c)
+     * @param r Row index (0-3)
+     * @param c Column index (0-3)
+     * @return Exponent (0 if empty)
+     */
+    int getExponent(int r, int c) const {
+        return static_cast<int>((bits >> ((r * 4 + c) * 4)) & 0xF);
+    }
+
+    /**
+     * Set tile exponent at position (r, c)
+     * @param r Row index (0-3)
+     * @param c Column index (0-3)
+     * @param exponent Exponent to store (0 clears the tile)
+     */
+    void setExponent(int r, int c, int exponent) {
+        const int shift = (r * 4 + c) * 4;
+        bits = (bits & ~(Bits(0xF) << shift)) | (Bits(exponent & 0xF) << shift);
+    }
+
+    /**
+     * Get tile value at position (r, c)
+     * @param r Row index (0-3)
+     * @param c Column index (0-3)
+     * @return Tile value (0 if empty)
+     */
+    int getValue(int r, int c) const {
+        const int exponent = getExponent(r, c);
+        return exponent == 0 ? 0 : (1 << exponent);
+    }
+
+    /**
+     * Remove all tiles
+     */
+    void clear() { bits = 0; }
+
+    /**
+     * Get a 16-bit mask with bit (r * 4 + c) set for every empty cell
+     * @return Empty cell mask
+     */
+    std::uint16_t getEmptyMask() const;
+
+    /**
+     * Count empty cells
+     * @return Number of empty cells
+     */
+    int countEmpty() const;
+
+    /**
+     * Find the n-th empty cell in row-major order, straight from the packed
+     * board (no list of empty cells is built)
+     * @param n Index among the empty cells, below countEmpty()
+     * @return Cell index r * 4 + c
+     */
+    int findEmptyCell(int n) const;
+
+    /**
+     * Get the largest tile exponent on the board
+     * @return Maximum exponent (0 if board is empty)
+     */
+    int getMaxExponent() const;
+
+    /**
+     * Check if any move is possible
+     * @return true if some direction changes the board
+     */
+    bool canMove() const;
+
+    /**
+     * Slide and merge tiles in a direction
+     * @param dir Direction to move
+     * @param scoreGained Receives the sum of merged tile values
+     * @return true if any tile moved
+     */
+    bool move(Direction dir, int& scoreGained);
+
+    /**
+     * Compute the result of a move without modifying a board
+     * @param packed Packed board bits
+     * @param dir Direction to move
+     * @return Packed board after the move
+     */
+    static Bits shift(Bits packed, Direction dir);
+
+    /**
+     * Compute the score a move would gain
+     * @param packed Packed board bits
+     * @param dir Direction to move
+     * @return Sum of merged tile values
+     */
+    static int scoreFor(Bits packed, Direction dir);
+
+    /**
+     * Transpose a packed board (rows become columns)
+     * @param packed Packed board bits
+     * @return Transposed board bits
+     */
+    static Bits transpose(Bits packed);
+};
+
+#endif // BOARD_2048_HPP
@@ -0,0 +1,21 @@
+#ifndef BUILTIN_ENGINES_HPP
+#define BUILTIN_ENGINES_HPP
+
+#include "../core/EngineFactory.hpp"
+#include "../observer/Subject.hpp"
+
+/**
+ * Registers the engines of the games shipped with the studio
+ * The SFML-free counterpart of BuiltinGames, under the same names
+ */
+class BuiltinEngines {
+public:
+    /**
+     * Register Tic-Tac-Toe, Gomoku, Sudoku and 2048 with a factory
+     * @param factory Factory to register with
+     * @param subject Subject the created engines notify on game over
+     */
+    static void registerAll(EngineFactory& factory, Subject& subject);
+};
+
+#endif // BUILTIN_ENGINES_HPP
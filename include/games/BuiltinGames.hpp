@@ -0,0 +1,21 @@
+#ifndef BUILTIN_GAMES_HPP
+#define BUILTIN_GAMES_HPP
+
+#include "../core/GameFactory.hpp"
+#include "../observer/Subject.hpp"
+
+/**
+ * Registers the games shipped with the studio
+ * Used by the windowed application; headless tools use BuiltinEngines
+ */
+class BuiltinGames {
+public:
+    /**
+     * Register Tic-Tac-Toe, Gomoku, Sudoku and 2048 with a factory
+     * @param factory Factory to register with
+     * @param subject Subject the created games notify on game over
+     */
+    static void registerAll(GameFactory& factory, Subject& subject);
+};
+
+#endif // BUILTIN_GAMES_HPP
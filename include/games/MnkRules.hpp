@@ -0,0 +1,35 @@
+#ifndef MNK_RULES_HPP
+#define MNK_RULES_HPP
+
+#include "../core/Grid.hpp"
+#include <optional>
+
+/**
+ * Win detection for m,n,k games (k or more in a row on an m x n board)
+ * Only lines through the last move are checked, so each check costs O(k)
+ * whatever the board size.
+ */
+class MnkRules {
+public:
+    /**
+     * Endpoints of a winning run
+     */
+    struct WinLine {
+        int startRow;
+        int startCol;
+        int endRow;
+        int endCol;
+    };
+
+    /**
+     * Check whether the mark at (row, col) completes a run of winLength
+     * @param board Board (' ' = empty)
+     * @param row Row of the last move
+     * @param col Column of the last move
+     * @param winLength Marks in a row needed to win
+     * @return Full extent of the run through the move, or std::nullopt
+     */
+    static std::optional<WinLine> findWin(const Grid<char>& board, int row, int col, int winLength);
+};
+
+#endif // MNK_RULES_HPP
@@ -0,0 +1,85 @@
+#ifndef PUZZLE_2048_ENGINE_HPP
+#define PUZZLE_2048_ENGINE_HPP
+
+#include "../core/GameEngine.hpp"
+#include "../observer/Subject.hpp"
+#include "Board2048.hpp"
+
+/**
+ * 2048 game state and rules
+ */
+class Puzzle2048Engine : public GameEngine {
+public:
+    static constexpr const char* Name = "2048 Puzzle";
+
+private:
+    Board2048 bitboard;
+    int score = 0;
+    bool won = false;
+    bool gameOver = false;
+    Subject* subject;
+
+    /**
+     * Slide and merge tiles in a direction
+     * @param dir Direction to move
+     * @return true if any tile moved
+     */
+    bool applyMove(Board2048::Direction dir);
+
+    /**
+     * Publish a tile-merged event for every merge a move made
+     * @param before Board before the move
+     * @param dir Direction of the move
+     */
+    void notifyMerges(const Board2048& before, Board2048::Direction dir);
+
+public:
+    /**
+     * Constructor
+     * @param subj Pointer to subject for notifications
+     */
+    explicit Puzzle2048Engine(Subject* subj = nullptr);
+
+    std::string getName() const override;
+    void init() override;
+
+    /**
+     * Legal actions are Board2048::Direction values cast to int
+     */
+    std::vector<int> getLegalActions() const override;
+    bool applyAction(int action) override;
+    bool isFinished() const override;
+
+    /**
+     * Make a move: slide, spawn a tile and check for game over
+     * @param dir Direction to move
+     * @return true if any tile moved
+     */
+    bool move(Board2048::Direction dir);
+
+    /**
+     * Spawn a new tile (2 or 4) on a random empty cell, drawn from the session rng
+     * Allocation-free, like the rest of move().
+     */
+    void spawnTile();
+
+    /**
+     * Get the packed board (for AI players and views)
+     * @return Current board
+     */
+    const Board2048& getBitboard() const { return bitboard; }
+
+    /**
+     * Get the current score
+     * @return Score
+     */
+    int getScore() const { return score; }
+
+    /**
+     * Check if a 2048 tile has been reached
+     * @return true if won
+     */
+    bool isWon() const { return won; }
+};
+
+#endif // PUZZLE_2048_ENGINE_HPP
@@ -4,18 +4,26 @@
 #include "../core/Game.hpp"
 #include "../core/Grid.hpp"
 #include "../observer/Subject.hpp"
+#include "Puzzle2048Engine.hpp"
+#include "../ai/Puzzle2048ExpectimaxAI.hpp"
+#include "../ui/BoardRenderer.hpp"
+#include "../util/ResourceCache.hpp"
+#include "../ui/TextCache.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
 
 /**
- * 2048 puzzle game implementation
+ * 2048 puzzle game: SFML view and input over Puzzle2048Engine
  */
 class Puzzle2048Game : public Game {
 private:
-    Grid<int> board;
-    bool gameOver;
-    bool won;
-    sf::Font font;
-    Subject* subject;
-    int score;
+    Puzzle2048Engine engine;  // Authoritative game state
+    Grid<int, 4, 4> board;    // Tile values mirrored from the engine for rendering
+    std::uint64_t syncedVersion = 0;  // Engine version board and hint were built from
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Panel labels, reused across frames
+    bool fontLoaded = false;
     bool isDragging = false;
     sf::Vector2i dragStart;
     sf::Vector2i dragEnd;
@@ -23,41 +31,36 @@ private:
     float gameOverTimer = 0.f;  // Timer to keep win message visible
     float celebrationTimer = 0.f;  // Timer for win celebration effects
     bool showMoveHint = true;
+    bool showAIHint = false;
+    std::optional<Board2048::Direction> aiHint;
+    std::unique_ptr<Puzzle2048ExpectimaxAI> hintAI;  // Created on first hint request
+    BoardRenderer boardRenderer;  // Cached board geometry, rebuilt when tiles or score change
     
     /**
-     * Spawn a new tile (2 or 4)
+     * Refresh the rendering grid and hint after the engine state changed
      */
-    void spawnTile();
+    void syncBoardView();
     
     /**
-     * Move tiles left
-     * @return true if any tile moved
+     * Make a move from player input
+     * @param dir Direction to move
      */
-    bool moveLeft();
+    void playMove(Board2048::Direction dir);
     
     /**
-     * Move tiles right
-     * @return true if any tile moved
+     * Load the font on first render (headless runs never load it)
      */
-    bool moveRight();
+    void ensureFontLoaded();
     
     /**
-     * Move tiles up
-     * @return true if any tile moved
+     * Rebuild the cached background, board, tiles and score batches
      */
-    bool moveUp();
+    void rebuildBoardLayers();
     
     /**
-     * Move tiles down
-     * @return true if any tile moved
+     * Recompute the AI hint for the current board (if hints are shown)
      */
-    bool moveDown();
-    
-    /**
-     * Check if any move is possible
-     * @return true if can move
-     */
-    bool canMove() const;
+    void refreshHint();
     
     /**
      * Get color for tile value
@@ -75,6 +78,11 @@ private:
      * Process drag direction and make move
      */
     void processDragDirection();
+    
+    /**
+     * Check if anything on screen changes without input
+     */
+    bool isAnimating() const;
 
 public:
     /**
@@ -87,8 +95,15 @@ public:
     void init() override;
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderWindow& window, float interpolation) override;
     bool isOver() const override;
+    /**
+     * Animated while the move hint shows, a 512+ tile glows or the result is shown
+     */
+    bool needsRedraw() const override { return isAnimating(); }
+    float getNextDeadline() const override { return isAnimating() ? 0.f : NoDeadline; }
+    Puzzle2048Engine& getEngine() override { return engine; }
+    const Puzzle2048Engine& getEngine() const override { return engine; }
 };
 
 #endif // PUZZLE_2048_GAME_HPP
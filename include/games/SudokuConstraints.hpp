@@ -0,0 +1,114 @@
+#ifndef SUDOKU_CONSTRAINTS_HPP
+#define SUDOKU_CONSTRAINTS_HPP
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Incremental constraint tracker for a 9x9 Sudoku board
+ * Keeps a 9-bit digit mask per row, column and 3x3 box (bit v-1 for digit v),
+ * updated on every placement and erase, so validity checks, conflict
+ * detection and solved detection are O(1) mask operations instead of scans.
+ */
+class SudokuConstraints {
+public:
+    static constexpr std::uint16_t AllDigits = 0x1FF;
+
+private:
+    // Units 0-8 are rows, 9-17 columns, 18-26 boxes
+    std::array<std::uint16_t, 27> usedMasks{};
+    std::array<std::uint16_t, 27> duplicateMasks{};
+    std::array<std::array<std::uint8_t, 9>, 27> counts{};
+    int filledCells = 0;
+    int duplicateCount = 0;
+
+    void adjust(int unit, int digitIndex, int delta);
+
+public:
+    /**
+     * Get the box index (0-8) for a cell
+     * @param r Row
+     * @param c Column
+     * @return Box index, numbered row-major
+     */
+    static int boxIndex(int r, int c) { return (r / 3) * 3 + c / 3; }
+
+    /**
+     * Count set bits in a digit mask
+     * @param mask Digit mask
+     * @return Number of digits in the mask
+     */
+    static int popcount(std::uint16_t mask) {
+        int count = 0;
+        for (; mask != 0; mask &= mask - 1) ++count;
+        return count;
+    }
+
+    /**
+     * Remove all digits
+     */
+    void clear();
+
+    /**
+     * Record a digit placed in a cell
+     * @param r Row
+     * @param c Column
+     * @param val Digit (1-9)
+     */
+    void place(int r, int c, int val);
+
+    /**
+     * Record a digit removed from a cell
+     * @param r Row
+     * @param c Column
+     * @param val Digit (1-9) that was in the cell
+     */
+    void erase(int r, int c, int val);
+
+    /**
+     * Get the digits used in a cell's row, column and box
+     * @param r Row
+     * @param c Column
+     * @return Digit mask
+     */
+    std::uint16_t getUsedMask(int r, int c) const {
+        return usedMasks[r] | usedMasks[9 + c] | usedMasks[18 + boxIndex(r, c)];
+    }
+
+    /**
+     * Get the digits that could go in an empty cell
+     * @param r Row
+     * @param c Column
+     * @return Candidate digit mask
+     */
+    std::uint16_t getCandidates(int r, int c) const {
+        return static_cast<std::uint16_t>(~getUsedMask(r, c) & AllDigits);
+    }
+
+    /**
+     * Check if a placed digit clashes with another cell in its row, column or box
+     * @param r Row
+     * @param c Column
+     * @param val Digit currently in the cell (1-9)
+     * @return true if the digit appears more than once in a unit
+     */
+    bool isConflict(int r, int c, int val) const {
+        const std::uint16_t bit = static_cast<std::uint16_t>(1u << (val - 1));
+        return ((duplicateMasks[r] | duplicateMasks[9 + c] |
+                 duplicateMasks[18 + boxIndex(r, c)]) & bit) != 0;
+    }
+
+    /**
+     * Check if every cell is filled without conflicts
+     * @return true if solved
+     */
+    bool isSolved() const { return filledCells == 81 && duplicateCount == 0; }
+
+    /**
+     * Get number of filled cells
+     * @return Filled cell count
+     */
+    int getFilledCells() const { return filledCells; }
+};
+
+#endif // SUDOKU_CONSTRAINTS_HPP
@@ -0,0 +1,134 @@
+#ifndef SUDOKU_ENGINE_HPP
+#define SUDOKU_ENGINE_HPP
+
+#include "../core/GameEngine.hpp"
+#include "../core/Grid.hpp"
+#include "../observer/Subject.hpp"
+#include "SudokuConstraints.hpp"
+#include "../ai/SudokuSolver.hpp"
+
+/**
+ * Sudoku game state and rules
+ */
+class SudokuEngine : public GameEngine {
+private:
+    Grid<int, 9, 9> board;          // Inline, no heap allocation
+    Grid<bool, 9, 9> fixedCells;
+    SudokuConstraints constraints;  // Row/column/box digit masks mirroring board
+    SudokuSolver::Difficulty difficulty = SudokuSolver::Difficulty::Medium;
+    bool gameOver = false;
+    Subject* subject;
+
+    /**
+     * Load a random puzzle of the current difficulty from the puzzle bank,
+     * or a built-in puzzle if no bank is available or the record is corrupt
+     */
+    void loadPuzzle();
+
+    /**
+     * Clear the board and place a puzzle's givens as fixed cells
+     */
+    void setGivens(const SudokuSolver::Puzzle& puzzle);
+
+    /**
+     * Set a cell value, keeping the constraint masks in sync
+     * @param r Row
+     * @param c Column
+     * @param val Value (0 to clear)
+     */
+    void setCell(int r, int c, int val);
+
+public:
+    /**
+     * First action code that clears a cell (see applyAction)
+     */
+    static constexpr int ClearActionBase = 729;
+
+    /**
+     * Constructor
+     * @param subj Pointer to subject for notifications
+     */
+    explicit SudokuEngine(Subject* subj = nullptr);
+
+    std::string getName() const override;
+
+    /**
+     * Deal a new puzzle of the current difficulty
+     */
+    void init() override;
+
+    /**
+     * Start a session on a fixed puzzle instead of one dealt from the bank,
+     * so benchmarks and checks do not depend on the installed bank
+     * Replays cannot reproduce such a session: they deal from the seed.
+     * @param puzzle Givens (0 = empty); they must not clash
+     */
+    void initFixed(const SudokuSolver::Puzzle& puzzle);
+
+    /**
+     * Legal actions encode row * 81 + col * 9 + (value - 1)
+     */
+    std::vector<int> getLegalActions() const override;
+
+    /**
+     * Apply a placement, or clear a cell for ClearActionBase + row * 9 + col
+     * Placements follow placeNumber, so they may overwrite a filled non-clue
+     * cell (getLegalActions lists only empty cells, but replays hold both)
+     */
+    bool applyAction(int action) override;
+    bool isFinished() const override;
+
+    /**
+     * Settings are the difficulty level
+     */
+    std::uint32_t getSettings() const override;
+    void applySettings(std::uint32_t settings) override;
+
+    /**
+     * Check if a move is valid
+     * @param r Row
+     * @param c Column
+     * @param val Value to place
+     * @return true if valid
+     */
+    bool isValidMove(int r, int c, int val) const;
+
+    /**
+     * Check if puzzle is solved
+     * @return true if solved
+     */
+    bool isSolved() const;
+
+    /**
+     * Place a number if the move is valid, and check for a solved board
+     * @param r Row
+     * @param c Column
+     * @param val Value to place (1-9)
+     * @return true if the number was placed
+     */
+    bool placeNumber(int r, int c, int val);
+
+    /**
+     * Clear a cell the player filled
+     * @param r Row
+     * @param c Column
+     * @return true if the cell is not a clue
+     */
+    bool clearCell(int r, int c);
+
+    /**
+     * Select the difficulty used by the next init()
+     */
+    void setDifficulty(SudokuSolver::Difficulty level) { difficulty = level; }
+    SudokuSolver::Difficulty getDifficulty() const { return difficulty; }
+
+    const Grid<int, 9, 9>& getBoard() const { return board; }
+    bool isFixed(int r, int c) const { return fixedCells(r, c); }
+
+    /**
+     * Check if a filled cell repeats a digit in its row, column or box
+     */
+    bool isConflict(int r, int c) const;
+};
+
+#endif // SUDOKU_ENGINE_HPP
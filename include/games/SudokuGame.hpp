@@ -2,46 +2,41 @@
 #define SUDOKU_GAME_HPP
 
 #include "../core/Game.hpp"
-#include "../core/Grid.hpp"
 #include "../observer/Subject.hpp"
+#include "SudokuEngine.hpp"
+#include "../ui/BoardRenderer.hpp"
+#include "../util/ResourceCache.hpp"
+#include "../ui/TextCache.hpp"
+#include <cstdint>
 
 /**
- * Sudoku puzzle game implementation
+ * Sudoku puzzle game: SFML view and input over SudokuEngine
  */
 class SudokuGame : public Game {
 private:
-    Grid<int> board;
-    Grid<bool> fixedCells;
-    bool gameOver;
-    sf::Font font;
-    Subject* subject;
-    int selectedRow;
-    int selectedCol;
+    SudokuEngine engine;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Panel labels, reused across frames
+    bool fontLoaded = false;
+    int selectedRow = -1;
+    int selectedCol = -1;
     int hoverRow = -1;
     int hoverCol = -1;
     float highlightTimer = 0.f;
     float gameOverTimer = 0.f;  // Timer to keep win message visible
     float celebrationTimer = 0.f;  // Timer for solve celebration
+    BoardRenderer boardRenderer;   // Cached board geometry
+    std::uint64_t renderVersion = 0;  // Bumped whenever selection or hover change (cells bump the engine version)
     
     /**
-     * Load a puzzle
+     * Load the font on first render (headless runs never load it)
      */
-    void loadPuzzle();
+    void ensureFontLoaded();
     
     /**
-     * Check if a move is valid
-     * @param r Row
-     * @param c Column
-     * @param val Value to place
-     * @return true if valid
+     * Rebuild the cached background, cells, numbers and grid lines
      */
-    bool isValidMove(int r, int c, int val) const;
-    
-    /**
-     * Check if puzzle is solved
-     * @return true if solved
-     */
-    bool isSolved() const;
+    void rebuildBoardLayers();
     
     /**
      * Handle mouse click
@@ -54,6 +49,11 @@ private:
      * Update hover cell based on mouse position
      */
     void updateHover(sf::Vector2i mousePos);
+    
+    /**
+     * Check if anything on screen changes without input
+     */
+    bool isAnimating() const;
 
 public:
     /**
@@ -66,8 +66,15 @@ public:
     void init() override;
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderWindow& window, float interpolation) override;
     bool isOver() const override;
+    /**
+     * Animated while a cell is selected, a conflict pulses or the result is shown
+     */
+    bool needsRedraw() const override { return isAnimating(); }
+    float getNextDeadline() const override { return isAnimating() ? 0.f : NoDeadline; }
+    SudokuEngine& getEngine() override { return engine; }
+    const SudokuEngine& getEngine() const override { return engine; }
 };
 
 #endif // SUDOKU_GAME_HPP
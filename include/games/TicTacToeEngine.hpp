@@ -0,0 +1,157 @@
+#ifndef TIC_TAC_TOE_ENGINE_HPP
+#define TIC_TAC_TOE_ENGINE_HPP
+
+#include "../core/GameEngine.hpp"
+#include "../core/Grid.hpp"
+#include "../observer/Subject.hpp"
+#include "../ai/TicTacToeStrategy.hpp"
+#include "MnkRules.hpp"
+#include <future>
+#include <memory>
+#include <optional>
+
+/**
+ * Tic-Tac-Toe game state and rules
+ * Generalized to m,n,k games: any board size and number in a row to win
+ * (3x3 with 3 is classic Tic-Tac-Toe, 15x15 with 5 is Gomoku). The AI
+ * opponent is part of the engine, but it never searches inside
+ * applyAction: views request its reply in the background (requestAIMove,
+ * pollAIMove) so the window keeps drawing, and headless drivers call
+ * playAIMove. Its replies are recorded and replayed like any move.
+ */
+class TicTacToeEngine : public GameEngine {
+private:
+    Grid<char> board;
+    int winLength;           // marks in a row needed to win
+    std::string gameName;
+    int movesPlayed = 0;
+    char currentPlayer = 'X';
+    bool gameOver = false;
+    std::optional<char> winner;
+    std::optional<MnkRules::WinLine> winLine;
+    Subject* subject;
+    bool vsAI = true;        // single-player vs AI by default
+    char aiSymbol = 'O';     // AI plays as 'O' by default
+    bool smartAI = true;     // perfect-play table (3x3) or alpha-beta search, else random moves
+    int aiTimeLimitMs = 250; // alpha-beta budget per reply
+    int aiMaxDepth = 12;     // alpha-beta iteration limit
+    std::unique_ptr<TicTacToeStrategy> aiStrategy; // AI move strategy
+    // Declared after aiStrategy, so a search still running is joined before the strategy goes
+    std::future<int> pendingAIMove;
+    int pendingAIMoveNumber = 0; // movesPlayed when the pending search started
+
+    /**
+     * Put a mark on an empty cell, record and notify it, and check for a result
+     * @param row Row
+     * @param col Column
+     */
+    void play(int row, int col);
+
+    /**
+     * Check for a winner through the last move, or a draw
+     * @param row Row of the last move
+     * @param col Column of the last move
+     */
+    void checkWinner(int row, int col);
+
+    /**
+     * Play the AI's chosen cell and pass the turn back
+     * @param cell Cell index row * cols + col, or -1 for none
+     * @return true if the move was played
+     */
+    bool playAICell(int cell);
+
+    /**
+     * Wait for a background search and drop its result
+     */
+    void cancelAIMove();
+
+public:
+    /**
+     * Constructor
+     * @param subj Pointer to subject for notifications
+     * @param rows Board rows
+     * @param cols Board columns
+     * @param k Marks in a row needed to win
+     * @param name Name reported to the factory and score board
+     */
+    explicit TicTacToeEngine(Subject* subj = nullptr, size_t rows = 3, size_t cols = 3, int k = 3,
+                             const std::string& name = "Tic-Tac-Toe");
+
+    std::string getName() const override;
+    void init() override;
+
+    /**
+     * Legal actions encode row * cols + col of an empty cell
+     */
+    std::vector<int> getLegalActions() const override;
+    bool applyAction(int action) override;
+    bool isFinished() const override;
+
+    /**
+     * Place the current player's mark (refused while it is the AI's turn)
+     * @param row Row
+     * @param col Column
+     * @return true if the cell was empty and the mark was placed
+     */
+    bool placeMark(int row, int col);
+
+    /**
+     * Enable or disable the AI opponent
+     */
+    void setVsAI(bool enabled);
+    bool isVsAI() const { return vsAI; }
+
+    /**
+     * Replace the AI strategy
+     * @param smart true for the perfect-play (3x3) or alpha-beta AI, false for random moves
+     */
+    void setAIStrategy(bool smart);
+    bool isSmartAI() const { return smartAI; }
+
+    /**
+     * Set the alpha-beta AI's search limits (the 3x3 table and random AI ignore them)
+     * A depth limit makes replies reproducible and fast, e.g. for headless runs
+     * @param timeLimitMs Wall-clock budget per reply
+     * @param maxDepth Deepest iteration
+     */
+    void setAILimits(int timeLimitMs, int maxDepth);
+
+    /**
+     * Check whether the AI opponent is to move (never while replaying)
+     */
+    bool isAITurn() const;
+
+    /**
+     * Search and play the AI's reply on this thread
+     * @return true if the AI moved
+     */
+    bool playAIMove();
+
+    /**
+     * Start searching the AI's reply in the background if it is its turn
+     * and no search is running yet
+     */
+    void requestAIMove();
+
+    /**
+     * Play the background search's reply once it is ready
+     * The reply is dropped if the position changed since the request.
+     * @return true if the AI moved
+     */
+    bool pollAIMove();
+
+    bool isAIThinking() const { return pendingAIMove.valid(); }
+
+    const Grid<char>& getBoard() const { return board; }
+    int getWinLength() const { return winLength; }
+    char getCurrentPlayer() const { return currentPlayer; }
+    const std::optional<char>& getWinner() const { return winner; }
+
+    /**
+     * Get the full run of the winning marks (std::nullopt until someone wins)
+     */
+    const std::optional<MnkRules::WinLine>& getWinLine() const { return winLine; }
+};
+
+#endif // TIC_TAC_TOE_ENGINE_HPP
@@ -2,34 +2,30 @@
 #define TIC_TAC_TOE_GAME_HPP
 
 #include "../core/Game.hpp"
-#include "../core/Grid.hpp"
 #include "../observer/Subject.hpp"
-#include <optional>
-#include "../ai/MoveStrategy.hpp"
-#include <memory>
+#include "TicTacToeEngine.hpp"
+#include "../ui/BoardRenderer.hpp"
+#include "../util/ResourceCache.hpp"
+#include "../ui/TextCache.hpp"
+#include <cstdint>
 
 /**
- * Tic-Tac-Toe game implementation
+ * Tic-Tac-Toe game: SFML view and input over TicTacToeEngine
  */
 class TicTacToeGame : public Game {
 private:
-    Grid<char> board;
-    char currentPlayer;
-    bool gameOver;
-    std::optional<char> winner;
-    sf::Font font;
-    Subject* subject;
+    TicTacToeEngine engine;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Panel labels, reused across frames
+    bool fontLoaded = false;
     int hoverRow = -1;
     int hoverCol = -1;
     float pulseTimer = 0.f;
     float gameOverTimer = 0.f;  // Timer to keep win message visible
     float winLineTimer = 0.f;  // Animation timer for winning line
-    bool hasWinLine = false;
-    int winLineStartRow = -1, winLineStartCol = -1;
-    int winLineEndRow = -1, winLineEndCol = -1;
-    bool vsAI = true;        // single-player vs AI by default
-    char aiSymbol = 'O';     // AI plays as 'O' by default
-    std::unique_ptr<MoveStrategy<Grid<char>>> aiStrategy; // AI move strategy
+    BoardRenderer boardRenderer;   // Cached board geometry
+    std::uint64_t renderVersion = 0;  // Bumped whenever hover changes (marks bump the engine version)
+    std::string instructionText;      // Built once, depends on winLength
     
     /**
      * Handle mouse click
@@ -39,33 +35,55 @@ private:
     void handleClick(sf::Vector2i pos, sf::RenderWindow& window);
     
     /**
-     * Check for winner
+     * Load the font on first render (headless runs never load it)
      */
-    void checkWinner();
+    void ensureFontLoaded();
+    
+    /**
+     * Get the on-screen size of one cell (the board fills 600x600)
+     */
+    float getCellSize() const;
+    
+    /**
+     * Rebuild the cached background, cells, grid lines and marks
+     */
+    void rebuildBoardLayers();
     
     /**
      * Update hover cell based on mouse position
      */
     void updateHover(sf::Vector2i mousePos);
-
+    
     /**
-     * Perform AI move when it's AI's turn
+     * Check if anything on screen changes without input
      */
-    void performAIMove();
+    bool isAnimating() const;
 
 public:
     /**
      * Constructor
      * @param subj Pointer to subject for notifications
+     * @param rows Board rows
+     * @param cols Board columns
+     * @param k Marks in a row needed to win
+     * @param name Name reported to the factory and score board
      */
-    explicit TicTacToeGame(Subject* subj = nullptr);
+    explicit TicTacToeGame(Subject* subj = nullptr, size_t rows = 3, size_t cols = 3, int k = 3,
+                           const std::string& name = "Tic-Tac-Toe");
     
     std::string getName() const override;
     void init() override;
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
-    void render(sf::RenderWindow& window) override;
+    void render(sf::RenderWindow& window, float interpolation) override;
     bool isOver() const override;
+    /**
+     * Animated while the hovered empty cell pulses, the AI is thinking or the result is shown
+     */
+    bool needsRedraw() const override { return isAnimating(); }
+    float getNextDeadline() const override { return isAnimating() ? 0.f : NoDeadline; }
+    TicTacToeEngine& getEngine() override { return engine; }
+    const TicTacToeEngine& getEngine() const override { return engine; }
 };
 
 #endif // TIC_TAC_TOE_GAME_HPP
@@ -0,0 +1,116 @@
+#ifndef GAME_EVENT_HPP
+#define GAME_EVENT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/**
+ * Fixed-capacity inline string for event payloads
+ * Longer text is truncated, so copying an event never allocates.
+ * @tparam N Capacity in bytes
+ */
+template<size_t N>
+struct FixedString {
+    static_assert(N > 0 && N < 256, "Length must fit in one byte");
+
+    char text[N];
+    std::uint8_t length;
+
+    void assign(std::string_view value) {
+        length = static_cast<std::uint8_t>(value.size() < N ? value.size() : N);
+        std::memcpy(text, value.data(), length);
+    }
+
+    std::string_view view() const { return std::string_view(text, length); }
+    std::string str() const { return std::string(text, length); }
+};
+
+/**
+ * Event published through Subject
+ * A tag plus a union of small payloads; trivially copyable so it can be
+ * queued by value in a ring buffer.
+ */
+struct GameEvent {
+    enum class Type : std::uint8_t {
+        GameOver,    // A game finished
+        MoveMade,    // A move was played (Tic-Tac-Toe mark, 2048 slide)
+        TileMerged,  // Two 2048 tiles merged
+        CellFilled   // A Sudoku cell was filled or cleared
+    };
+
+    static constexpr size_t TypeCount = 4;
+
+    struct GameOverData {
+        FixedString<32> player;
+        FixedString<48> result;
+    };
+
+    struct MoveData {
+        std::int32_t action;  // Game-specific action id (see Game::applyAction)
+        std::int16_t row;     // Cell played, or -1 if the move has no cell
+        std::int16_t col;
+        char player;          // Mark of the player who moved, or 0
+    };
+
+    struct TileData {
+        std::int16_t row;     // Cell of the merged tile after the move
+        std::int16_t col;
+        std::int32_t value;   // Value of the merged tile
+    };
+
+    struct CellData {
+        std::int16_t row;
+        std::int16_t col;
+        std::int8_t value;    // Digit placed, or 0 if the cell was cleared
+    };
+
+    Type type;
+    FixedString<32> game;
+    union {
+        GameOverData gameOver;
+        MoveData move;
+        TileData tile;
+        CellData cell;
+    };
+
+    GameEvent() : type(Type::GameOver), game(), gameOver() {}
+
+    static GameEvent makeGameOver(std::string_view gameName, std::string_view playerName,
+                                  std::string_view result) {
+        GameEvent event = make(Type::GameOver, gameName);
+        event.gameOver.player.assign(playerName);
+        event.gameOver.result.assign(result);
+        return event;
+    }
+
+    static GameEvent makeMove(std::string_view gameName, int action, int row, int col, char player) {
+        GameEvent event = make(Type::MoveMade, gameName);
+        event.move = {action, static_cast<std::int16_t>(row), static_cast<std::int16_t>(col), player};
+        return event;
+    }
+
+    static GameEvent makeTileMerged(std::string_view gameName, int row, int col, int value) {
+        GameEvent event = make(Type::TileMerged, gameName);
+        event.tile = {static_cast<std::int16_t>(row), static_cast<std::int16_t>(col), value};
+        return event;
+    }
+
+    static GameEvent makeCellFilled(std::string_view gameName, int row, int col, int value) {
+        GameEvent event = make(Type::CellFilled, gameName);
+        event.cell = {static_cast<std::int16_t>(row), static_cast<std::int16_t>(col),
+                      static_cast<std::int8_t>(value)};
+        return event;
+    }
+
+private:
+    static GameEvent make(Type type, std::string_view gameName) {
+        GameEvent event;
+        event.type = type;
+        event.game.assign(gameName);
+        return event;
+    }
+};
+
+#endif // GAME_EVENT_HPP
@@ -1,11 +1,13 @@
 #ifndef OBSERVER_HPP
 #define OBSERVER_HPP
 
+#include "GameEvent.hpp"
 #include <string>
 
 /**
  * Abstract Observer interface
- * Part of the Observer design pattern
+ * Part of the Observer design pattern. Callbacks run on the Subject's
+ * dispatcher thread, not on the thread of the game that raised the event.
  */
 class Observer {
 public:
@@ -19,6 +21,22 @@ public:
     virtual void onGameOver(const std::string& playerName,
                             const std::string& gameName,
                             const std::string& result) = 0;
+
+    /**
+     * Called for every other event type the observer wants
+     * @param event Move, tile merge or cell event
+     */
+    virtual void onEvent(const GameEvent& /*event*/) {}
+
+    /**
+     * Select the event types delivered to this observer; games skip
+     * building events nobody wants
+     * @param type Event type
+     * @return true to receive it (only game over by default)
+     */
+    virtual bool wantsEvent(GameEvent::Type type) const {
+        return type == GameEvent::Type::GameOver;
+    }
 };
 
 #endif // OBSERVER_HPP
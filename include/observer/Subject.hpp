@@ -1,20 +1,66 @@
 #ifndef SUBJECT_HPP
 #define SUBJECT_HPP
 
+#include "GameEvent.hpp"
 #include "Observer.hpp"
-#include <vector>
+#include "../util/MpscRingBuffer.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 /**
  * Subject class for Observer pattern
- * Manages observers and notifies them of events
+ * Manages observers and notifies them of events. Notifications are copied
+ * into a lock-free ring buffer and delivered by a dispatcher thread, so the
+ * notifying game never waits for an observer; events of a type no observer
+ * wants are dropped before they are queued.
  */
 class Subject {
+public:
+    static constexpr size_t QueueCapacity = 1024;
+
 private:
-    std::vector<Observer*> observers;
+    using EventQueue = MpscRingBuffer<GameEvent, QueueCapacity>;
+
+    std::vector<Observer*> observers;           // Guarded by observersMutex
+    std::mutex observersMutex;                  // Held while events are delivered
+    std::atomic<std::uint32_t> eventMask{0};    // Bit per type some observer wants
     std::string activePlayerName = "Player";
 
+    std::unique_ptr<EventQueue> queue;
+    std::atomic<std::uint64_t> published{0};
+    std::atomic<std::uint64_t> stalls{0};       // Pushes that found the queue full
+    std::atomic<bool> dispatcherIdle{false};
+    std::uint64_t dispatched = 0;               // Guarded by waitMutex
+    std::mutex waitMutex;
+    std::condition_variable wake;               // Dispatcher: events or stop
+    std::condition_variable drained;            // Callers of flush(): events delivered
+    bool stopping = false;
+    std::thread dispatcher;
+    std::thread::id dispatcherId;
+
+    void dispatchLoop();
+    void deliver(const GameEvent& event);
+    void publish(const GameEvent& event);
+    void updateEventMask();
+
 public:
+    Subject();
+
+    /**
+     * Destructor; delivers queued events and stops the dispatcher
+     */
+    ~Subject();
+
+    Subject(const Subject&) = delete;
+    Subject& operator=(const Subject&) = delete;
+
     /**
      * Add an observer
      * @param obs Pointer to observer
@@ -23,16 +69,70 @@ public:
     
     /**
      * Remove an observer
+     * Events published before the call are still delivered to it; no
+     * callback runs on it after the call returns.
      * @param obs Pointer to observer
      */
     void removeObserver(Observer* obs);
     
+    /**
+     * Check whether any observer wants an event type
+     * @param type Event type
+     */
+    bool isListening(GameEvent::Type type) const {
+        return (eventMask.load(std::memory_order_relaxed) & (1u << static_cast<unsigned>(type))) != 0;
+    }
+
     /**
      * Notify all observers that a game is over
      * @param gameName Name of the game
      * @param result Result of the game
      */
-    void notifyGameOver(const std::string& gameName, const std::string& result);
+    void notifyGameOver(std::string_view gameName, std::string_view result);
+
+    /**
+     * Notify observers of a move
+     * @param gameName Name of the game
+     * @param action Game-specific action id
+     * @param row Row played, or -1
+     * @param col Column played, or -1
+     * @param player Mark of the moving player, or 0
+     */
+    void notifyMoveMade(std::string_view gameName, int action, int row, int col, char player = 0);
+
+    /**
+     * Notify observers that two tiles merged
+     * @param gameName Name of the game
+     * @param row Row of the merged tile
+     * @param col Column of the merged tile
+     * @param value Value of the merged tile
+     */
+    void notifyTileMerged(std::string_view gameName, int row, int col, int value);
+
+    /**
+     * Notify observers that a cell was filled (value 0: cleared)
+     * @param gameName Name of the game
+     * @param row Cell row
+     * @param col Cell column
+     * @param value Digit placed
+     */
+    void notifyCellFilled(std::string_view gameName, int row, int col, int value);
+
+    /**
+     * Block until every event published so far has been delivered
+     * (returns immediately when called from an observer callback)
+     */
+    void flush();
+
+    /**
+     * Get number of events queued so far
+     */
+    std::uint64_t getPublishedCount() const { return published.load(std::memory_order_relaxed); }
+
+    /**
+     * Get number of pushes that had to wait for a full queue
+     */
+    std::uint64_t getStallCount() const { return stalls.load(std::memory_order_relaxed); }
 
     /**
      * Set the active player's name for upcoming score notifications
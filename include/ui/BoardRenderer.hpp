@@ -0,0 +1,108 @@
+#ifndef BOARD_RENDERER_HPP
+#define BOARD_RENDERER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Batched, cached geometry for a game board
+ * Rectangles are collected into one vertex array per layer and labels into
+ * one glyph vertex array per character size, so a whole board is drawn in a
+ * handful of draw calls. Games rebuild the batches only when their render
+ * key (a version counter or packed board) changes; the Animated layer is
+ * meant to be refilled every frame with the few pulsing cells.
+ */
+class BoardRenderer {
+public:
+    /**
+     * Layers, drawn in this order
+     * All text batches are drawn after the last layer, so labels sit above
+     * even the Overlay layer (grid lines, highlights). Anything that must
+     * cover labels, such as a game-over panel, is drawn after draw().
+     */
+    enum class Layer { Background, Shadows, Cells, Animated, Overlay };
+    static constexpr size_t LayerCount = 5;
+
+private:
+    struct TextBatch {
+        unsigned characterSize;
+        sf::VertexArray vertices;
+    };
+
+    std::array<sf::VertexArray, LayerCount> layers;
+    std::vector<TextBatch> textBatches;
+    const sf::Font* font = nullptr;
+    std::uint64_t key = 0;
+    bool built = false;
+
+    sf::VertexArray& batchFor(unsigned characterSize);
+
+public:
+    BoardRenderer();
+
+    /**
+     * Check whether the cached batches are stale
+     * @param stateKey Key describing everything the static layers depend on
+     * @return true if rebuild() must be called before drawing
+     */
+    bool needsRebuild(std::uint64_t stateKey) const { return !built || stateKey != key; }
+
+    /**
+     * Start a rebuild: clears every layer except Animated and all text
+     * @param stateKey Key the new batches correspond to
+     */
+    void rebuild(std::uint64_t stateKey);
+
+    /**
+     * Force a rebuild on the next needsRebuild check
+     */
+    void invalidate() { built = false; }
+
+    /**
+     * Remove all geometry from one layer
+     */
+    void clearLayer(Layer layer);
+
+    /**
+     * Add a filled rectangle
+     */
+    void addRect(Layer layer, float x, float y, float width, float height, sf::Color color);
+
+    /**
+     * Add a filled rectangle with an outline drawn outside it (as sf::Shape does)
+     */
+    void addOutlinedRect(Layer layer, float x, float y, float width, float height, sf::Color fill,
+                         float outlineThickness, sf::Color outline);
+
+    /**
+     * Add a label laid out like sf::Text at the given position
+     * @param f Font (must outlive the renderer's use of it; one font per renderer)
+     * @param text ASCII string
+     * @param characterSize Character size in pixels
+     * @param bold Bold glyphs
+     * @param position Top-left position as with sf::Text::setPosition
+     * @param color Fill color
+     */
+    void addText(const sf::Font& f, const std::string& text, unsigned characterSize, bool bold,
+                 sf::Vector2f position, sf::Color color);
+
+    /**
+     * Measure a label as sf::Text::getLocalBounds would
+     */
+    static sf::FloatRect measureText(const sf::Font& f, const std::string& text, unsigned characterSize, bool bold);
+
+    /**
+     * Draw all layers in Layer order, then all text batches
+     */
+    void draw(sf::RenderTarget& target) const;
+
+    /**
+     * Get the number of draw calls draw() issues
+     */
+    size_t getDrawCallCount() const;
+};
+
+#endif // BOARD_RENDERER_HPP
@@ -0,0 +1,36 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <SFML/Graphics.hpp>
+
+/**
+ * Idle waiting for event-driven loops
+ * Loops render only after input or when their screen or game asks for a
+ * frame, and otherwise sleep here until the next event or animation
+ * deadline, so a static screen costs next to no CPU.
+ */
+class FramePacer {
+public:
+    /**
+     * Longest sleep between event polls while a deadline is pending
+     * (SFML 2 has no timed waitEvent)
+     */
+    static constexpr float PollInterval = 0.01f;
+
+    /**
+     * Shortest wait, so a loop that drew nothing never spins
+     */
+    static constexpr float MinWait = 1.f / 60.f;
+
+    /**
+     * Wait for the next event, for at most timeout seconds
+     * Blocks in waitEvent when the timeout is infinite.
+     * @param window Window to take events from
+     * @param event Receives the event
+     * @param timeout Seconds to wait
+     * @return true if an event was received
+     */
+    static bool waitEvent(sf::RenderWindow& window, sf::Event& event, float timeout);
+};
+
+#endif // FRAME_PACER_HPP
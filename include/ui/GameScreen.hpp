@@ -0,0 +1,66 @@
+#ifndef GAME_SCREEN_HPP
+#define GAME_SCREEN_HPP
+
+#include "../core/Screen.hpp"
+#include "../core/GameFactory.hpp"
+#include "../core/GameManager.hpp"
+#include "../core/ScreenManager.hpp"
+#include "../util/ScoreBoard.hpp"
+#include "../observer/Subject.hpp"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <string>
+
+/**
+ * Scene hosting the GameManager's game in the application window
+ * Starts the session when constructed and ends it (saving the replay) when
+ * replaced; Escape or the end of the game returns to the main menu. The
+ * time from the launch request to the first drawn game frame is printed
+ * once, and checked against the one-frame budget.
+ */
+class GameScreen : public Screen {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr unsigned Width = 1000;
+    static constexpr unsigned Height = 750;
+    static constexpr double SwitchBudgetMs = 1000.0 / 60.0;   // One frame at 60 Hz
+
+private:
+    GameFactory& factory;
+    GameManager& gameManager;
+    ScoreBoard& scoreBoard;
+    ScreenManager& screenManager;
+    Subject& subject;
+    std::string title;
+    Clock::time_point launchTime;
+    bool firstFrameDrawn = false;
+    bool leaving = false;
+
+    void returnToMenu();
+
+public:
+    /**
+     * Constructor
+     * @param launch When the game was requested, for the switch latency
+     */
+    GameScreen(GameFactory& f,
+               GameManager& gm,
+               ScoreBoard& sb,
+               ScreenManager& sm,
+               Subject& subj,
+               Clock::time_point launch);
+    ~GameScreen() override;
+
+    void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
+    bool handleEscape() override;
+    void update(float dt) override;
+    void render(sf::RenderWindow& window) override;
+
+    bool needsRedraw() const override { return !firstFrameDrawn || gameManager.needsRedraw(); }
+    float getNextDeadline() const override { return firstFrameDrawn ? gameManager.getNextDeadline() : 0.f; }
+    sf::Vector2u getWindowSize() const override { return {Width, Height}; }
+    std::string getWindowTitle() const override { return title; }
+};
+
+#endif // GAME_SCREEN_HPP
@@ -7,20 +7,28 @@
 #include "../util/ScoreBoard.hpp"
 #include "../core/ScreenManager.hpp"
 #include "../observer/Subject.hpp"
+#include "../util/ResourceCache.hpp"
+#include "TextCache.hpp"
 #include <SFML/Graphics.hpp>
 #include <vector>
 
 /**
  * Main menu screen
+ * Particles and the title glow animate until the menu has had no input for
+ * AttractSeconds; it then stays still (and the loop idles) until the next event.
  */
 class MainMenuScreen : public Screen {
+public:
+    static constexpr float AttractSeconds = 20.f;
+
 private:
     GameFactory& factory;
     GameManager& gameManager;
     ScoreBoard& scoreBoard;
     ScreenManager& screenManager;
     Subject& subject;
-    sf::Font font;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Panel labels, reused across frames
     std::vector<std::string> menuItems;
     int selectedIndex;
     struct Particle {
@@ -29,6 +37,7 @@ private:
     };
     std::vector<Particle> particles;
     float glowTimer = 0.f;
+    float idleSeconds = 0.f;         // Time since the last input event
 
 public:
     /**
@@ -47,6 +56,8 @@ public:
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
     void render(sf::RenderWindow& window) override;
+    bool needsRedraw() const override { return idleSeconds < AttractSeconds; }
+    float getNextDeadline() const override { return idleSeconds < AttractSeconds ? 0.f : NoDeadline; }
 
 private:
     void selectCurrentItem(sf::RenderWindow& window);
@@ -7,10 +7,15 @@
 #include "../core/ScreenManager.hpp"
 #include "../util/ScoreBoard.hpp"
 #include "../observer/Subject.hpp"
+#include "../util/ResourceCache.hpp"
+#include "TextCache.hpp"
 #include <SFML/Graphics.hpp>
 #include <string>
 
 class NameEntryScreen : public Screen {
+public:
+    static constexpr float CaretBlinkSeconds = 0.5f;
+
 private:
     GameFactory& factory;
     GameManager& gameManager;
@@ -18,10 +23,13 @@ private:
     ScreenManager& screenManager;
     Subject& subject;
     std::string gameName;
-    sf::Font font;
+    std::string titleText;  // Built once; render() looks it up in the text cache
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Labels, reused across frames
     std::string playerName;
     float caretTimer = 0.f;
     bool caretVisible = true;
+    bool caretChanged = false;       // Caret blinked since the last render
 
 public:
     NameEntryScreen(GameFactory& f,
@@ -34,9 +42,15 @@ public:
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
     void render(sf::RenderWindow& window) override;
+    
+    /**
+     * Redrawn after input and when the caret blinks
+     */
+    bool needsRedraw() const override { return caretChanged; }
+    float getNextDeadline() const override { return CaretBlinkSeconds - caretTimer; }
 
 private:
-    void launchGameAndReturn();
+    void launchGame();
 };
 
 #endif // NAME_ENTRY_SCREEN_HPP
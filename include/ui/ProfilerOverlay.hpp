@@ -0,0 +1,53 @@
+#ifndef PROFILER_OVERLAY_HPP
+#define PROFILER_OVERLAY_HPP
+
+#include "../util/FrameProfiler.hpp"
+#include "../util/ResourceCache.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+
+/**
+ * Toggleable frame-time overlay for a loop
+ * F3 shows/hides p50/p99/max of each frame phase; F4 starts a trace
+ * recording and, pressed again, writes it to TraceFile as Chrome
+ * trace-event JSON. The lines are re-formatted every RefreshFrames frames
+ * rather than every frame, so the overlay itself stays cheap.
+ */
+class ProfilerOverlay {
+public:
+    static constexpr const char* TraceFile = "frame_trace.json";
+    static constexpr int RefreshFrames = 30;
+
+private:
+    static constexpr size_t LineCount = FrameProfiler::SectionCount + 2;
+
+    FrameProfiler& profiler;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    std::array<sf::Text, LineCount> lines;
+    bool visible = false;
+    int framesUntilRefresh = 0;
+
+    void refresh();
+
+public:
+    /**
+     * Constructor
+     * @param prof Profiler to display
+     */
+    explicit ProfilerOverlay(FrameProfiler& prof = FrameProfiler::instance());
+
+    /**
+     * Handle the overlay's keys
+     * @return true if the event was consumed
+     */
+    bool handleEvent(const sf::Event& event);
+
+    /**
+     * Draw the overlay in the top-right corner (if visible)
+     */
+    void render(sf::RenderWindow& window);
+
+    bool isVisible() const { return visible; }
+};
+
+#endif // PROFILER_OVERLAY_HPP
@@ -4,6 +4,10 @@
 #include "../core/Screen.hpp"
 #include "../util/ScoreBoard.hpp"
 #include "../core/ScreenManager.hpp"
+#include "../util/ResourceCache.hpp"
+#include "TextCache.hpp"
+#include <string>
+#include <vector>
 
 /**
  * ScoreBoard display screen
@@ -12,8 +16,21 @@ class ScoreBoardScreen : public Screen {
 private:
     ScoreBoard& scoreBoard;
     ScreenManager& screenManager;
-    sf::Font font;
-    float animationTime = 0.f;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Panel labels, reused across frames
+    
+    struct CardLines {
+        std::string headline;
+        std::string detail;
+    };
+    std::vector<CardLines> recentCards;   // Newest first, at most 10
+    std::vector<CardLines> legendCards;   // Top 3 players
+    int shownGames = -1;                  // Games count the cards were built for
+    
+    /**
+     * Rebuild the card strings if new games were recorded
+     */
+    void refreshCards();
 
 public:
     /**
@@ -26,6 +43,12 @@ public:
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
     void render(sf::RenderWindow& window) override;
+    
+    /**
+     * Static screen: redrawn after input or when a new score is recorded
+     */
+    bool needsRedraw() const override;
+    float getNextDeadline() const override { return NoDeadline; }
 };
 
 #endif // SCOREBOARD_SCREEN_HPP
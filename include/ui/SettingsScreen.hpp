@@ -3,6 +3,8 @@
 
 #include "../core/Screen.hpp"
 #include "../core/ScreenManager.hpp"
+#include "../util/ResourceCache.hpp"
+#include "TextCache.hpp"
 
 /**
  * Settings screen
@@ -10,7 +12,8 @@
 class SettingsScreen : public Screen {
 private:
     ScreenManager& screenManager;
-    sf::Font font;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    TextCache texts;                 // Labels, reused across frames
 
 public:
     /**
@@ -22,6 +25,12 @@ public:
     void handleEvent(const sf::Event& event, sf::RenderWindow& window) override;
     void update(float dt) override;
     void render(sf::RenderWindow& window) override;
+    
+    /**
+     * Static screen: drawn only after input
+     */
+    bool needsRedraw() const override { return false; }
+    float getNextDeadline() const override { return NoDeadline; }
 };
 
 #endif // SETTINGS_SCREEN_HPP
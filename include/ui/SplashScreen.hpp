@@ -7,6 +7,7 @@
 #include "../core/GameManager.hpp"
 #include "../util/ScoreBoard.hpp"
 #include "../observer/Subject.hpp"
+#include "../util/ResourceCache.hpp"
 #include <SFML/Graphics.hpp>
 
 class SplashScreen : public Screen {
@@ -16,8 +17,8 @@ private:
     GameManager& gameManager;
     ScoreBoard& scoreBoard;
     Subject& subject;
-    sf::Font font;
-    sf::Texture logoTexture;
+    ResourceCache::FontHandle font;  // Shared with other screens and games
+    ResourceCache::TextureHandle logoTexture;
     sf::Sprite logoSprite;
     float timer = 0.f;
     float fadeAlpha = 0.f;
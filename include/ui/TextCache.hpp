@@ -0,0 +1,102 @@
+#ifndef TEXT_CACHE_HPP
+#define TEXT_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Cache of laid-out sf::Text objects keyed by (string, size, style)
+ * render() code asks for a text every frame; a hit returns the existing
+ * sf::Text with its glyph geometry intact, so only colour and position are
+ * set before drawing and no string is allocated. Lookups reuse a scratch key,
+ * and numbers are formatted into it directly instead of via std::to_string.
+ * Past its capacity (e.g. a score that keeps changing) the least recently
+ * used entry is recycled for the new text, so other entries, and the
+ * references handed out for them, stay put.
+ */
+class TextCache {
+private:
+    struct Key {
+        std::string text;
+        unsigned characterSize = 0;
+        sf::Uint32 style = 0;
+
+        bool operator==(const Key& other) const {
+            return characterSize == other.characterSize && style == other.style && text == other.text;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        sf::Text text;
+    };
+
+    const sf::Font* font = nullptr;
+    std::list<Entry> entries;   // Most recently used first; nodes never move in memory
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+    Key scratch;
+    size_t capacity;
+
+    sf::Text& lookup();
+
+public:
+    static constexpr size_t DefaultCapacity = 256;
+
+    /**
+     * Constructor
+     * @param maxEntries Entries kept before the least recently used is recycled
+     */
+    explicit TextCache(size_t maxEntries = DefaultCapacity);
+
+    /**
+     * Set the font used for new texts (clears the cache if it changes)
+     */
+    void setFont(const sf::Font& f);
+
+    /**
+     * Get a text
+     * The reference is valid until its entry is recycled, which takes
+     * capacity other texts requested after it: use it before asking for
+     * that many more (one frame's worth in practice), and do not keep it
+     * across frames.
+     * @param text String to display
+     * @param characterSize Character size
+     * @param style sf::Text style flags
+     * @return Cached text; set colour and position before drawing
+     */
+    sf::Text& get(const std::string& text, unsigned characterSize, sf::Uint32 style = sf::Text::Regular);
+    sf::Text& get(const char* text, unsigned characterSize, sf::Uint32 style = sf::Text::Regular);
+
+    /**
+     * Get a text made of a prefix followed by a decimal number
+     * @param prefix Text before the number (may be empty)
+     * @param value Number to display
+     * @param characterSize Character size
+     * @param style sf::Text style flags
+     * @return Cached text; set colour and position before drawing
+     */
+    sf::Text& getNumber(const char* prefix, long long value, unsigned characterSize,
+                        sf::Uint32 style = sf::Text::Regular);
+
+    /**
+     * Drop all cached texts
+     */
+    void clear() {
+        index.clear();
+        entries.clear();
+    }
+
+    /**
+     * Get number of cached texts
+     */
+    size_t size() const { return entries.size(); }
+};
+
+#endif // TEXT_CACHE_HPP
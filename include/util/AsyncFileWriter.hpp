@@ -0,0 +1,130 @@
+#ifndef ASYNC_FILE_WRITER_HPP
+#define ASYNC_FILE_WRITER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Background writer for append-only text files
+ * append() only queues the line; a writer thread collects lines for up to
+ * the flush interval (or until a batch fills), then writes each file's lines
+ * with one open and one write. Durability is set by the sync policy, and the
+ * queue is drained on flush(), shutdown() and destruction.
+ */
+class AsyncFileWriter {
+public:
+    /**
+     * When written data is forced to disk with fsync
+     */
+    enum class SyncPolicy {
+        Never,    // Leave it to the OS
+        OnFlush,  // On flush(), shutdown() and destruction
+        Always    // After every batch
+    };
+
+    struct Config {
+        std::chrono::milliseconds flushInterval{50};  // Longest time a line waits in the queue
+        size_t maxBatchLines = 256;                    // Write early once this many lines are queued
+        SyncPolicy sync = SyncPolicy::OnFlush;
+    };
+
+private:
+    struct Pending {
+        std::string filename;
+        std::string line;
+    };
+
+    Config config;
+    std::mutex mutex;
+    std::condition_variable wake;     // Writer: work, flush request or stop
+    std::condition_variable drained;  // Callers of flush(): lines written
+    std::vector<Pending> queue;
+    std::set<std::string> unsynced;   // Files written since their last fsync (used by the writer)
+    std::uint64_t enqueued = 0;
+    std::uint64_t written = 0;
+    std::uint64_t batches = 0;
+    std::uint64_t passesStarted = 0;
+    std::uint64_t passesCompleted = 0;
+    int flushRequests = 0;
+    bool stopping = false;
+    bool stopped = false;
+    std::thread worker;
+
+    void run();
+
+    /**
+     * Append a batch to its files (called without the lock held, so it must not read config)
+     * @param batch Lines to write; filenames are moved out
+     * @param sync Sync policy captured under the lock
+     * @param syncAll Sync these files and every file left unsynced
+     */
+    void writeBatch(std::vector<Pending>& batch, SyncPolicy sync, bool syncAll);
+
+public:
+    /**
+     * Constructor with the default configuration; the writer thread starts
+     * on the first append
+     */
+    AsyncFileWriter();
+
+    /**
+     * Constructor
+     * @param cfg Writer configuration
+     */
+    explicit AsyncFileWriter(const Config& cfg);
+
+    /**
+     * Destructor; drains the queue (see shutdown)
+     */
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter&) = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    /**
+     * Queue a line (a newline is added) without touching the filesystem
+     * After shutdown() lines are written synchronously instead.
+     * @param filename Path to file
+     * @param line Line to append
+     */
+    void append(const std::string& filename, const std::string& line);
+
+    /**
+     * Block until every line queued so far is written (and synced, unless
+     * the policy is Never)
+     */
+    void flush();
+
+    /**
+     * Drain the queue and stop the writer thread
+     */
+    void shutdown();
+
+    /**
+     * Replace the configuration; takes effect from the next batch
+     */
+    void setConfig(const Config& cfg);
+
+    /**
+     * Get the configuration
+     */
+    Config getConfig();
+
+    /**
+     * Get number of lines written so far
+     */
+    std::uint64_t getWrittenLines();
+
+    /**
+     * Get number of batches written so far
+     */
+    std::uint64_t getBatchCount();
+};
+
+#endif // ASYNC_FILE_WRITER_HPP
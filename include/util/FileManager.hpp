@@ -1,6 +1,7 @@
 #ifndef FILE_MANAGER_HPP
 #define FILE_MANAGER_HPP
 
+#include "AsyncFileWriter.hpp"
 #include <string>
 #include <vector>
 
@@ -11,6 +12,8 @@ class FileManager {
 public:
     /**
      * Append a line to a file
+     * The line is queued for a background writer and written in a later batch;
+     * use flush() when it must be on disk.
      * @param filename Path to file
      * @param line Line to append
      */
@@ -18,6 +21,7 @@ public:
     
     /**
      * Read all lines from a file
+     * Lines still queued by appendLine are written first.
      * @param filename Path to file
      * @return Vector of lines
      */
@@ -29,6 +33,23 @@ public:
      * @return true if file exists
      */
     static bool fileExists(const std::string& filename);
+
+    /**
+     * Block until every appended line is written (and synced, per the policy)
+     */
+    static void flush();
+
+    /**
+     * Set flush interval, batch size and sync policy of the background writer
+     * @param config Writer configuration
+     */
+    static void configureWriter(const AsyncFileWriter::Config& config);
+
+    /**
+     * Drain queued lines and stop the background writer
+     * Later appends are written synchronously.
+     */
+    static void shutdownWriter();
 };
 
 #endif // FILE_MANAGER_HPP
@@ -0,0 +1,80 @@
+#ifndef FIXED_TIMESTEP_HPP
+#define FIXED_TIMESTEP_HPP
+
+#include <algorithm>
+
+/**
+ * Fixed-timestep update scheduler
+ * Frame times are added to an accumulator that is drained in whole steps,
+ * so updates always see the same dt however fast or slow frames are drawn.
+ * At most MaxStepsPerFrame steps run per frame; time beyond that is dropped
+ * (the simulation slows down instead of spending ever longer catching up).
+ * The remainder, as a fraction of a step, is the interpolation alpha for
+ * rendering between the last update and the next.
+ */
+class FixedTimestep {
+public:
+    static constexpr float DefaultStep = 1.f / 60.f;
+    static constexpr int DefaultMaxSteps = 5;
+
+private:
+    float step;
+    int maxSteps;
+    float accumulator = 0.f;
+    float droppedSeconds = 0.f;
+
+public:
+    /**
+     * Constructor
+     * @param stepSeconds Simulated time per update
+     * @param maxStepsPerFrame Most updates run for one frame
+     */
+    explicit FixedTimestep(float stepSeconds = DefaultStep, int maxStepsPerFrame = DefaultMaxSteps)
+        : step(stepSeconds), maxSteps(maxStepsPerFrame) {}
+
+    /**
+     * Add a frame's time and run the updates it pays for
+     * @param dt Seconds since the previous frame
+     * @param update Called as update(step) once per step
+     * @return Number of updates run
+     */
+    template<typename Update>
+    int advance(float dt, Update&& update) {
+        accumulator += std::max(dt, 0.f);
+        const float maxAccumulated = step * static_cast<float>(maxSteps);
+        if (accumulator > maxAccumulated) {
+            droppedSeconds += accumulator - maxAccumulated;
+            accumulator = maxAccumulated;
+        }
+        int steps = 0;
+        while (accumulator >= step) {
+            update(step);
+            accumulator -= step;
+            ++steps;
+        }
+        return steps;
+    }
+
+    /**
+     * Get how far rendering is between the last update and the next
+     * @return Fraction of a step in [0, 1)
+     */
+    float getAlpha() const { return accumulator / step; }
+
+    float getStep() const { return step; }
+
+    /**
+     * Get the frame time dropped by the catch-up limit so far
+     */
+    float getDroppedSeconds() const { return droppedSeconds; }
+
+    /**
+     * Discard accumulated time (e.g. when a new session starts)
+     */
+    void reset() {
+        accumulator = 0.f;
+        droppedSeconds = 0.f;
+    }
+};
+
+#endif // FIXED_TIMESTEP_HPP
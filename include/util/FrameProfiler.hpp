@@ -0,0 +1,180 @@
+#ifndef FRAME_PROFILER_HPP
+#define FRAME_PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Frame-time profiler for the main-thread loops
+ * Each loop (the main window, replay playback) brackets its frames with
+ * beginFrame/endFrame and its phases with Scope timers. Phase times of the
+ * last HistorySize frames are kept per loop in ring buffers, from which
+ * p50/p99/max are computed. Games run as screens of the main loop, so their
+ * work lands in its phases. A loop started from inside another would be
+ * subtracted from the outer loop's timers rather than show up there as one
+ * long frame. While tracing, every scope is also recorded for export as
+ * Chrome trace-event JSON (chrome://tracing, Perfetto).
+ */
+class FrameProfiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Timed phases of a frame
+     */
+    enum class Section : std::uint8_t {
+        Events,   // Polling and handling window events
+        Update,   // Game/screen update
+        Render,   // Clear and draw calls
+        Display,  // Buffer swap (includes the frame-limit wait)
+        Frame     // Whole frame
+    };
+
+    static constexpr size_t SectionCount = 5;
+    static constexpr size_t HistorySize = 256;       // Frames kept per loop
+    static constexpr size_t MaxTraceEvents = 1 << 20;
+
+    struct Summary {
+        double p50Ms = 0.0;
+        double p99Ms = 0.0;
+        double maxMs = 0.0;
+    };
+
+    /**
+     * Times one section of the current frame of the innermost loop
+     */
+    class Scope {
+        FrameProfiler& profiler;
+        Section section;
+        Clock::time_point start;
+        Clock::duration excludedAtStart;
+        bool active;
+
+    public:
+        Scope(FrameProfiler& prof, Section sec);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    };
+
+    /**
+     * Makes a loop the target of frames and scopes while it is alive
+     */
+    class Loop {
+        FrameProfiler& profiler;
+        Clock::time_point start;
+
+    public:
+        Loop(FrameProfiler& prof, const char* name);
+        ~Loop();
+        Loop(const Loop&) = delete;
+        Loop& operator=(const Loop&) = delete;
+    };
+
+private:
+    struct Ring {
+        std::array<std::uint32_t, HistorySize> micros{};  // Microseconds per frame
+        size_t next = 0;
+        size_t count = 0;
+
+        void push(std::uint32_t value);
+    };
+
+    struct LoopStats {
+        const char* name;
+        std::array<Ring, SectionCount> rings;
+        std::array<Clock::duration, SectionCount> current{};  // Accumulated this frame
+        Clock::time_point frameStart;
+        Clock::duration excludedAtFrameStart{};
+        bool inFrame = false;
+    };
+
+    struct TraceEvent {
+        const char* name;
+        const char* loop;
+        std::int64_t startMicros;
+        std::int64_t durationMicros;
+    };
+
+    std::vector<LoopStats> loops;
+    std::vector<size_t> activeLoops;        // Stack of indices into loops
+    Clock::duration excluded{};              // Total time spent in nested loops
+    Clock::time_point epoch;
+    std::vector<TraceEvent> trace;
+    bool enabled = true;
+    bool tracing = false;
+
+    FrameProfiler();
+
+    LoopStats* currentLoop();
+    void addSample(Section section, Clock::time_point start, Clock::time_point end,
+                   Clock::duration excludedSince);
+
+public:
+    FrameProfiler(const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+    /**
+     * Get the shared profiler (main thread only)
+     */
+    static FrameProfiler& instance();
+
+    /**
+     * Start a frame of the innermost loop
+     */
+    void beginFrame();
+
+    /**
+     * Finish the frame and push its section times into the history
+     */
+    void endFrame();
+
+    /**
+     * Get p50/p99/max of a section over the innermost loop's history
+     */
+    Summary getSummary(Section section) const;
+
+    /**
+     * Get name of the innermost loop ("" if none)
+     */
+    const char* getLoopName() const;
+
+    /**
+     * Enable or disable timing (scopes cost one branch when disabled)
+     */
+    void setEnabled(bool value) { enabled = value; }
+    bool isEnabled() const { return enabled; }
+
+    /**
+     * Start recording trace events (clears the previous recording)
+     */
+    void startTrace();
+
+    /**
+     * Stop recording trace events
+     */
+    void stopTrace() { tracing = false; }
+    bool isTracing() const { return tracing; }
+
+    /**
+     * Get number of recorded trace events
+     */
+    size_t getTraceEventCount() const { return trace.size(); }
+
+    /**
+     * Write the recorded events as Chrome trace-event JSON
+     * @param filename Output path
+     * @return true if the file was written
+     */
+    bool writeChromeTrace(const std::string& filename) const;
+
+    /**
+     * Get display name of a section
+     */
+    static const char* sectionName(Section section);
+};
+
+#endif // FRAME_PROFILER_HPP
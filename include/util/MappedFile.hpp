@@ -0,0 +1,60 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Read-only memory mapping of a whole file
+ * Uses mmap on POSIX and file mappings on Windows; the contents are paged
+ * in by the OS on first access instead of being read up front.
+ */
+class MappedFile {
+private:
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#else
+    int fd = -1;
+#endif
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Map a file, closing any previous mapping
+     * @param filename Path to file
+     * @return true if the file was mapped (an empty file maps to zero bytes)
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * Unmap the file
+     */
+    void close();
+
+    /**
+     * Check if a file is mapped
+     */
+    bool isOpen() const;
+
+    /**
+     * Get mapped bytes (nullptr for an empty or closed file)
+     */
+    const unsigned char* getData() const { return data; }
+
+    /**
+     * Get mapped size in bytes
+     */
+    size_t getSize() const { return size; }
+};
+
+#endif // MAPPED_FILE_HPP
@@ -0,0 +1,97 @@
+#ifndef MPSC_RING_BUFFER_HPP
+#define MPSC_RING_BUFFER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * Bounded lock-free multi-producer single-consumer queue
+ * Each slot carries a sequence number: producers claim a slot by advancing
+ * the tail with a CAS, copy the value in and publish it by bumping the
+ * slot's sequence; the single consumer reads slots in order without any
+ * atomic read-modify-write. Values are copied in place, so nothing is
+ * allocated per push.
+ * @tparam T Trivially copyable value type
+ * @tparam Capacity Number of slots (power of two)
+ */
+template<typename T, size_t Capacity>
+class MpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // Producer and consumer positions live on separate cache lines
+    alignas(64) std::atomic<size_t> tail{0};
+    alignas(64) size_t head = 0;
+    alignas(64) std::array<Slot, Capacity> slots;
+
+public:
+    MpscRingBuffer() {
+        for (size_t i = 0; i < Capacity; ++i) {
+            slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+    /**
+     * Push a value (any thread)
+     * @return false if the buffer is full
+     */
+    bool tryPush(const T& value) {
+        size_t pos = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Slot& slot = slots[pos & (Capacity - 1)];
+            const size_t seq = slot.sequence.load(std::memory_order_acquire);
+            const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = value;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // The consumer has not freed this slot yet
+            } else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Pop the oldest value (consumer thread only)
+     * @return false if the buffer is empty
+     */
+    bool tryPop(T& value) {
+        Slot& slot = slots[head & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1) {
+            return false;
+        }
+        value = slot.value;
+        slot.sequence.store(head + Capacity, std::memory_order_release);
+        ++head;
+        return true;
+    }
+
+    /**
+     * Check whether the next slot holds a value (consumer thread only)
+     */
+    bool empty() const {
+        return slots[head & (Capacity - 1)].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    /**
+     * Get number of slots
+     */
+    static constexpr size_t capacity() { return Capacity; }
+};
+
+#endif // MPSC_RING_BUFFER_HPP
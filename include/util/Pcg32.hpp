@@ -0,0 +1,78 @@
+#ifndef PCG32_HPP
+#define PCG32_HPP
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * PCG32 random number generator (PCG-XSH-RR, 64-bit state, 32-bit output)
+ * 16 bytes of state, seeded in two steps and a few cycles per number, where
+ * std::mt19937 carries 5 KB and runs 624 steps on every seed(). Satisfies
+ * UniformRandomBitGenerator, so it also works with the <random>
+ * distributions; bounded() draws from a small range without constructing
+ * one.
+ */
+class Pcg32 {
+public:
+    using result_type = std::uint32_t;
+
+    static constexpr std::uint64_t DefaultSeed = 0x853C49E6748FEA9BULL;
+    static constexpr std::uint64_t DefaultStream = 0xDA3E39CB94B95BDBULL;
+
+private:
+    static constexpr std::uint64_t Multiplier = 6364136223846793005ULL;
+
+    std::uint64_t state = 0;
+    std::uint64_t increment = 1;
+
+public:
+    /**
+     * Constructor
+     * @param value Seed
+     */
+    explicit Pcg32(std::uint64_t value = DefaultSeed) { seed(value); }
+
+    /**
+     * Restart the sequence
+     * @param value Seed
+     * @param stream Selects one of 2^63 independent sequences
+     */
+    void seed(std::uint64_t value, std::uint64_t stream = DefaultStream) {
+        state = 0;
+        increment = (stream << 1) | 1;
+        (*this)();
+        state += value;
+        (*this)();
+    }
+
+    result_type operator()() {
+        const std::uint64_t old = state;
+        state = old * Multiplier + increment;
+        const auto xorShifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+        const auto rotation = static_cast<std::uint32_t>(old >> 59);
+        return (xorShifted >> rotation) | (xorShifted << ((0u - rotation) & 31));
+    }
+
+    /**
+     * Draw a uniform integer in [0, bound) without modulo bias
+     * (Lemire's multiply-shift; the retry loop almost never runs)
+     * @param bound Exclusive upper limit, greater than 0
+     */
+    std::uint32_t bounded(std::uint32_t bound) {
+        std::uint64_t product = static_cast<std::uint64_t>((*this)()) * bound;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < bound) {
+            const std::uint32_t threshold = (0u - bound) % bound;
+            while (low < threshold) {
+                product = static_cast<std::uint64_t>((*this)()) * bound;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+};
+
+#endif // PCG32_HPP
@@ -0,0 +1,39 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Recorded game session: enough to re-execute it exactly
+ *
+ * File layout (native little-endian):
+ *   28-byte header: magic "GSRP", byte-order mark 0x01020304, version,
+ *   seed, settings, game name length, action count
+ *   Game name bytes, then one 16-bit action code per action
+ */
+struct Replay {
+    static constexpr std::uint32_t Version = 2;   // 2: GameEngine::rng is PCG32 (was mt19937)
+
+    std::string game;                     // Name the game is registered under
+    std::uint32_t seed = 0;               // Session seed (GameEngine::getSeed)
+    std::uint32_t settings = 0;           // GameEngine::getSettings at the session start
+    std::vector<std::uint16_t> actions;   // Accepted applyAction codes in order
+
+    /**
+     * Write the replay with a single write
+     * @param path Path to replay file
+     * @return true if the file was written
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * Read a replay file
+     * @param path Path to replay file
+     * @return true if the file is a valid replay
+     */
+    bool load(const std::string& path);
+};
+
+#endif // REPLAY_HPP
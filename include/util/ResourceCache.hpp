@@ -0,0 +1,81 @@
+#ifndef RESOURCE_CACHE_HPP
+#define RESOURCE_CACHE_HPP
+
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Process-wide cache of fonts and textures
+ * Each file is parsed once and shared through reference-counted handles, so
+ * screens and games created on every transition reuse the loaded glyph data.
+ * The cache keeps its own reference, which keeps resources alive across
+ * transitions; purgeUnused() drops the ones nobody else holds.
+ */
+class ResourceCache {
+public:
+    using FontHandle = std::shared_ptr<sf::Font>;
+    using TextureHandle = std::shared_ptr<sf::Texture>;
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, FontHandle> fonts;
+    std::unordered_map<std::string, TextureHandle> textures;
+    FontHandle placeholderFont;  // Returned when no default font can be loaded
+
+    ResourceCache();
+
+public:
+    ResourceCache(const ResourceCache&) = delete;
+    ResourceCache& operator=(const ResourceCache&) = delete;
+
+    /**
+     * Get the shared cache
+     */
+    static ResourceCache& instance();
+
+    /**
+     * Get a font, loading it on first use
+     * @param filename Path to font file
+     * @return Shared font, or nullptr if it could not be loaded
+     */
+    FontHandle acquireFont(const std::string& filename);
+
+    /**
+     * Get the UI font (assets/fonts/arial.ttf, falling back to the system Arial)
+     * @return Shared font; an empty placeholder font if neither file loads
+     */
+    FontHandle acquireDefaultFont();
+
+    /**
+     * Check whether a handle is the empty placeholder font
+     */
+    bool isPlaceholder(const FontHandle& font) const { return font == placeholderFont; }
+
+    /**
+     * Get a texture, loading it on first use
+     * @param filename Path to image file
+     * @return Shared texture, or nullptr if it could not be loaded
+     */
+    TextureHandle acquireTexture(const std::string& filename);
+
+    /**
+     * Release every resource not referenced outside the cache
+     * @return Number of resources released
+     */
+    size_t purgeUnused();
+
+    /**
+     * Get number of cached fonts
+     */
+    size_t getFontCount() const;
+
+    /**
+     * Get number of cached textures
+     */
+    size_t getTextureCount() const;
+};
+
+#endif // RESOURCE_CACHE_HPP
@@ -2,43 +2,117 @@
 #define SCOREBOARD_HPP
 
 #include "../observer/Observer.hpp"
+#include "ScoreEntry.hpp"
+#include "ScoreLog.hpp"
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 /**
  * ScoreBoard class that observes game events
- * Stores and manages game scores
+ * Stores and manages game scores. The score file is parsed once on
+ * construction; entries and per-player/per-game aggregates are then kept in
+ * memory and updated incrementally as games finish, so queries never touch
+ * the file. Files ending in ".bin" use the binary ScoreLog format instead
+ * of pipe-delimited text; aggregates are then built from the mapped records
+ * by string id, and entry strings are only materialized on request.
+ * Games are recorded on the Subject's dispatcher thread, so every query
+ * takes the board's mutex.
  */
 class ScoreBoard : public Observer {
 public:
-    struct ScoreEntry {
-        std::string timestamp;
-        std::string playerName;
-        std::string gameName;
-        std::string result;
+    using ScoreEntry = ::ScoreEntry;
+
+    /**
+     * Aggregates for one player
+     */
+    struct PlayerStats {
+        int gamesPlayed = 0;
+        int wins = 0;
     };
 
 private:
     std::string filename;
+    mutable std::mutex mutex;  // Guards everything below
+    ScoreLog log;              // Open when the board is backed by a binary log
+    mutable std::vector<ScoreEntry> entries;  // Lazily filled from the log in binary mode
+    mutable bool entriesLoaded = false;
+    int totalGames = 0;
+    std::unordered_map<std::string, PlayerStats> players;
+    std::unordered_map<std::string, int> gameCounts;
+
+    /**
+     * Read every entry of the score file into memory
+     */
+    void load();
+
+    /**
+     * Build the aggregates from a binary log without materializing entries
+     */
+    void loadFromLog();
+
+    /**
+     * Tally one game into the aggregates
+     */
+    void tally(const std::string& playerName, const std::string& gameName, bool win, int count = 1);
+
+    /**
+     * Add an entry to the in-memory list and aggregates
+     */
+    void record(ScoreEntry entry);
+
+    /**
+     * Check whether a result counts as a win
+     */
+    static bool isWin(const std::string& result);
 
 public:
     /**
      * Constructor
-     * @param file Path to score file
+     * @param file Path to score file (text, or a binary log if it ends in ".bin")
      */
     explicit ScoreBoard(const std::string& file);
     
     /**
-     * Get all scores
-     * @return Vector of score entries
+     * Get all scores, oldest first
+     * The reference is only stable while no game is being recorded.
+     * @return Score entries
+     */
+    const std::vector<ScoreEntry>& getEntries() const;
+    
+    /**
+     * Get the most recent scores without materializing the whole history
+     * @param count Maximum number of entries
+     * @return Entries, newest first
      */
-    std::vector<ScoreEntry> getEntries() const;
+    std::vector<ScoreEntry> getRecentEntries(size_t count) const;
     
     /**
-     * Get player statistics
+     * Get player statistics in O(1)
+     * @return Games played and achievement title
      */
     std::pair<int, std::string> getPlayerStats(const std::string& playerName) const;
     
+    /**
+     * Get the aggregates of one player
+     * @return Stats (zero if the player has no entries)
+     */
+    PlayerStats getPlayerAggregates(const std::string& playerName) const;
+    
+    /**
+     * Get number of recorded games of one game type
+     */
+    int getGameCount(const std::string& gameName) const;
+    
+    /**
+     * Get the players with the most recorded games
+     * @param count Maximum number of players
+     * @return (player, games played) pairs, most games first, ties by name
+     */
+    std::vector<std::pair<std::string, int>> getTopPlayers(size_t count) const;
+    
     /**
      * Get total games played
      */
@@ -0,0 +1,16 @@
+#ifndef SCORE_ENTRY_HPP
+#define SCORE_ENTRY_HPP
+
+#include <string>
+
+/**
+ * One recorded game result, as shown on the scoreboard
+ */
+struct ScoreEntry {
+    std::string timestamp;
+    std::string playerName;
+    std::string gameName;
+    std::string result;
+};
+
+#endif // SCORE_ENTRY_HPP
@@ -0,0 +1,178 @@
+#ifndef SCORE_LOG_HPP
+#define SCORE_LOG_HPP
+
+#include "MappedFile.hpp"
+#include "ScoreEntry.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Binary append-only score log
+ *
+ * File layout (native little-endian, every chunk 8-byte aligned):
+ *   16-byte header: magic "SCLG", byte-order mark 0x01020304, version,
+ *   record size, reserved word
+ *   Chunks, each starting with a 32-bit tag (chunk type in the low byte):
+ *   - String chunk: length in the upper 24 bits of the tag, then the bytes;
+ *     strings get ids 0, 1, 2... in file order (player and game names,
+ *     non-standard results and timestamps are interned here once)
+ *   - Record chunk: one Record (32 bytes)
+ *
+ * A score is appended with a single write of its new strings and record.
+ * Reading maps the file and indexes chunk offsets; records are used in
+ * place, with no text parsing.
+ */
+class ScoreLog {
+public:
+    /**
+     * Result category; every category except Text is rebuilt from value
+     */
+    enum class Outcome : std::uint8_t {
+        Text,       // Free-form result, stored in the string table
+        Winner,     // "Winner: <value as char>"
+        Draw,       // "Draw"
+        Solved,     // "Solved!"
+        ScoreWon,   // "Score: <value> (Won!)"
+        ScoreOver   // "Score: <value> (Game Over)"
+    };
+
+    /**
+     * One score, used in place from the mapping
+     */
+    struct Record {
+        std::uint32_t tag;        // ChunkRecord
+        std::uint32_t player;     // String id
+        std::uint32_t game;       // String id
+        std::uint32_t result;     // String id for Outcome::Text, else NoString
+        std::uint64_t timestamp;  // Packed calendar fields (see packTimestamp), or
+                                  // TimestampString << 42 | string id for other formats
+        std::int32_t value;       // Numeric result
+        std::uint8_t outcome;     // Outcome
+        std::uint8_t reserved[3];
+    };
+
+    static constexpr size_t HeaderSize = 16;
+    static constexpr std::uint32_t Version = 1;
+    static constexpr std::uint32_t NoString = 0xFFFFFFFFu;
+    static constexpr std::uint32_t ChunkString = 'S';
+    static constexpr std::uint32_t ChunkRecord = 'R';
+    static constexpr std::uint64_t TimestampString = 7;
+
+private:
+    struct StringRef {
+        size_t offset;
+        std::uint32_t length;
+    };
+
+    std::string filename;
+    MappedFile file;
+    std::vector<StringRef> strings;
+    std::vector<size_t> records;                          // Offsets of record chunks
+    std::unordered_map<std::string, std::uint32_t> ids;   // Interned strings
+    size_t validSize = 0;                                 // Bytes indexed so far
+    bool valid = false;
+
+    /**
+     * Index chunks from validSize to the end of the mapping
+     * @return false if a chunk is malformed (indexing stops before it)
+     */
+    bool indexChunks();
+
+    /**
+     * Get the id of a string, appending a string chunk to out if it is new
+     */
+    std::uint32_t intern(const std::string& text, std::string& out, std::uint32_t& nextId,
+                         std::unordered_map<std::string, std::uint32_t>& added) const;
+
+public:
+    ScoreLog() = default;
+
+    /**
+     * Open a log, creating it with an empty header if it does not exist
+     * A truncated tail left by an interrupted write is cut off.
+     * @param path Path to log file
+     * @return true if the log is usable
+     */
+    bool open(const std::string& path);
+
+    /**
+     * Check if a valid log is open
+     */
+    bool isOpen() const { return valid; }
+
+    /**
+     * Append one score with a single write
+     * Records previously returned by record() are invalidated (the file is remapped).
+     * @return true if the score was written
+     */
+    bool append(const ScoreEntry& entry);
+
+    /**
+     * Append many scores with a single write
+     * @return true if the scores were written
+     */
+    bool append(const std::vector<ScoreEntry>& batch);
+
+    /**
+     * Get number of records
+     */
+    size_t size() const { return records.size(); }
+
+    /**
+     * Get a record (index must be < size())
+     */
+    const Record& record(size_t index) const {
+        return *reinterpret_cast<const Record*>(file.getData() + records[index]);
+    }
+
+    /**
+     * Get an interned string (id must be a valid string id)
+     */
+    std::string_view string(std::uint32_t id) const;
+
+    /**
+     * Get number of interned strings
+     */
+    size_t stringCount() const { return strings.size(); }
+
+    /**
+     * Rebuild the display text of a record's result
+     */
+    std::string resultText(const Record& rec) const;
+
+    /**
+     * Rebuild the display text of a record's timestamp
+     */
+    std::string timestampText(const Record& rec) const;
+
+    /**
+     * Rebuild a full entry (index must be < size())
+     */
+    ScoreEntry entry(size_t index) const;
+
+    /**
+     * Classify a result string
+     * @param result Result text
+     * @param value Receives the numeric result
+     * @return Outcome; Text unless the string is rebuilt exactly from value
+     */
+    static Outcome classify(const std::string& result, std::int32_t& value);
+
+    /**
+     * Pack "YYYY", "YYYY-MM-DD", "YYYY-MM-DD HH:MM" or "YYYY-MM-DD HH:MM:SS"
+     * Bits: seconds 0-5, minutes 6-11, hours 12-16, day 17-21, month 22-25,
+     * year 26-41, number of fields present 42-44.
+     * @return Packed value, or 0 if the text has another format
+     */
+    static std::uint64_t packTimestamp(const std::string& text);
+
+    /**
+     * Format a packed timestamp back into its original text
+     */
+    static std::string formatTimestamp(std::uint64_t packed);
+};
+
+#endif // SCORE_LOG_HPP
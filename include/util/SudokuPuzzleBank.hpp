@@ -0,0 +1,85 @@
+#ifndef SUDOKU_PUZZLE_BANK_HPP
+#define SUDOKU_PUZZLE_BANK_HPP
+
+#include "MappedFile.hpp"
+#include "../ai/SudokuSolver.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Compact on-disk bank of pre-generated Sudoku puzzles
+ *
+ * File layout (little-endian):
+ *   32-byte header: magic "SDKB", version, record size, puzzle count per
+ *   difficulty (Easy, Medium, Hard, Expert), reserved word
+ *   Records grouped by difficulty in that order; each record packs the 81
+ *   cells as 4-bit digits, two per byte (41 bytes)
+ *
+ * The file is memory-mapped, so opening is O(1) and any puzzle is read
+ * directly from its offset.
+ */
+class SudokuPuzzleBank {
+public:
+    using Puzzle = SudokuSolver::Puzzle;
+    using Difficulty = SudokuSolver::Difficulty;
+
+    static constexpr size_t HeaderSize = 32;
+    static constexpr size_t RecordSize = 41;
+    static constexpr std::uint32_t Version = 1;
+
+private:
+    MappedFile file;
+    std::array<std::uint32_t, SudokuSolver::DifficultyCount> counts{};
+    std::array<size_t, SudokuSolver::DifficultyCount> offsets{};
+    bool valid = false;
+
+public:
+    SudokuPuzzleBank() = default;
+
+    /**
+     * Constructor that opens a bank file
+     * @param filename Path to bank file
+     */
+    explicit SudokuPuzzleBank(const std::string& filename);
+
+    /**
+     * Map a bank file and validate its header
+     * @param filename Path to bank file
+     * @return true if the bank is usable
+     */
+    bool open(const std::string& filename);
+
+    /**
+     * Check if a valid bank is open
+     */
+    bool isOpen() const { return valid; }
+
+    /**
+     * Get number of puzzles of a difficulty
+     */
+    size_t count(Difficulty difficulty) const;
+
+    /**
+     * Read one puzzle
+     * The record is checked, since the file may be corrupt: every digit must
+     * be 0-9 and no two givens may clash in a row, column or box.
+     * @param difficulty Difficulty section
+     * @param index Index within the section
+     * @return Puzzle, or std::nullopt if the index is out of range or the record is invalid
+     */
+    std::optional<Puzzle> get(Difficulty difficulty, size_t index) const;
+
+    /**
+     * Write a bank file
+     * @param filename Path to bank file
+     * @param puzzles Puzzles indexed by difficulty
+     * @return true if the file was written
+     */
+    static bool write(const std::string& filename,
+                      const std::array<std::vector<Puzzle>, SudokuSolver::DifficultyCount>& puzzles);
+};
+
+#endif // SUDOKU_PUZZLE_BANK_HPP
@@ -0,0 +1,77 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Fixed-size thread pool with per-worker task queues
+ * Each worker pops from the back of its own queue and, when empty, steals
+ * from the front of the others, so uneven tasks still keep every core busy.
+ * Tasks submitted from inside a worker go to that worker's own queue.
+ */
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::mutex stateMutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    std::atomic<size_t> pending{0};    // Submitted but not finished
+    std::atomic<size_t> queued{0};     // Submitted but not started
+    std::atomic<size_t> nextQueue{0};
+    std::exception_ptr firstError;
+    bool stopping = false;
+
+    bool tryPop(size_t self, Task& task);
+    void workerLoop(size_t index);
+
+public:
+    /**
+     * Constructor
+     * @param threadCount Number of workers (0 = one per hardware thread)
+     */
+    explicit WorkStealingPool(size_t threadCount = 0);
+
+    /**
+     * Destructor; finishes queued tasks before joining the workers
+     */
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /**
+     * Queue a task
+     * @param task Function to run on a worker thread
+     */
+    void submit(Task task);
+
+    /**
+     * Block until every submitted task has finished
+     * Rethrows the first exception thrown by a task, if any
+     */
+    void wait();
+
+    /**
+     * Get number of worker threads
+     */
+    size_t getThreadCount() const { return workers.size(); }
+};
+
+#endif // WORK_STEALING_POOL_HPP
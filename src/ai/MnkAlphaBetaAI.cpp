@@ -0,0 +1,304 @@
+#include "../include/ai/MnkAlphaBetaAI.hpp"
+#include <algorithm>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr std::int64_t WinScore = 1000000000000LL;
+constexpr std::int64_t Infinity = WinScore * 2;
+constexpr int NearbyRadius = 2;
+
+std::uint64_t splitMix64(std::uint64_t& state) {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+bool isDecisive(std::int64_t score) {
+    return score >= WinScore - 10000 || score <= -WinScore + 10000;
+}
+}
+
+MnkAlphaBetaAI::MnkAlphaBetaAI() : MnkAlphaBetaAI(Config()) {}
+
+MnkAlphaBetaAI::MnkAlphaBetaAI(const Config& cfg) : config(cfg) {
+    config.winLength = std::max(config.winLength, 2);
+    config.maxDepth = std::max(config.maxDepth, 1);
+    table.resize(size_t(1) << std::max(config.tableBits, 1));
+
+    // Window values grow 8x per mark so one longer run outweighs many shorter ones
+    weights.assign(config.winLength + 1, 0);
+    std::int64_t w = 1;
+    for (int n = 1; n <= config.winLength; ++n) {
+        weights[n] = w;
+        w *= 8;
+    }
+}
+
+void MnkAlphaBetaAI::setupGeometry(int r, int c) {
+    rows = r;
+    cols = c;
+    const int cellCount = rows * cols;
+    const int k = config.winLength;
+
+    std::uint64_t seed = 0x6D6E6B2D7A6F6272ULL;
+    zobrist.resize(cellCount * 2);
+    for (auto& key : zobrist) key = splitMix64(seed);
+    sideKey = splitMix64(seed);
+
+    // Enumerate every k-cell window in the four line directions
+    static const int Directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    std::vector<std::vector<int>> windowsOf(cellCount);
+    int windowId = 0;
+    for (const auto& dir : Directions) {
+        for (int row = 0; row < rows; ++row) {
+            for (int col = 0; col < cols; ++col) {
+                const int endRow = row + (k - 1) * dir[0];
+                const int endCol = col + (k - 1) * dir[1];
+                if (endRow < 0 || endRow >= rows || endCol < 0 || endCol >= cols) continue;
+                for (int i = 0; i < k; ++i) {
+                    windowsOf[(row + i * dir[0]) * cols + col + i * dir[1]].push_back(windowId);
+                }
+                ++windowId;
+            }
+        }
+    }
+
+    cellWindows.clear();
+    cellWindowStart.assign(cellCount + 1, 0);
+    nearbyCells.clear();
+    nearbyStart.assign(cellCount + 1, 0);
+    for (int cell = 0; cell < cellCount; ++cell) {
+        cellWindowStart[cell] = static_cast<int>(cellWindows.size());
+        cellWindows.insert(cellWindows.end(), windowsOf[cell].begin(), windowsOf[cell].end());
+
+        nearbyStart[cell] = static_cast<int>(nearbyCells.size());
+        const int row = cell / cols;
+        const int col = cell % cols;
+        for (int dr = -NearbyRadius; dr <= NearbyRadius; ++dr) {
+            for (int dc = -NearbyRadius; dc <= NearbyRadius; ++dc) {
+                const int nr = row + dr;
+                const int nc = col + dc;
+                if ((dr != 0 || dc != 0) && nr >= 0 && nr < rows && nc >= 0 && nc < cols) {
+                    nearbyCells.push_back(nr * cols + nc);
+                }
+            }
+        }
+    }
+    cellWindowStart[cellCount] = static_cast<int>(cellWindows.size());
+    nearbyStart[cellCount] = static_cast<int>(nearbyCells.size());
+
+    windowCount[0].assign(windowId, 0);
+    windowCount[1].assign(windowId, 0);
+    std::fill(table.begin(), table.end(), TableEntry());
+}
+
+std::int64_t MnkAlphaBetaAI::placeGain(int cell, int player) const {
+    // Change in evaluation (from player's side) if player marked this cell
+    const auto& mine = windowCount[player];
+    const auto& theirs = windowCount[1 - player];
+    std::int64_t gain = 0;
+    for (int i = cellWindowStart[cell]; i < cellWindowStart[cell + 1]; ++i) {
+        const int w = cellWindows[i];
+        if (theirs[w] == 0) {
+            gain += weights[mine[w] + 1] - weights[mine[w]];
+        } else if (mine[w] == 0) {
+            gain += weights[theirs[w]];  // Their window is now dead
+        }
+    }
+    return gain;
+}
+
+bool MnkAlphaBetaAI::place(int cell, int player) {
+    const std::int64_t gain = placeGain(cell, player);
+    evaluation += (player == 0) ? gain : -gain;
+
+    bool wins = false;
+    auto& mine = windowCount[player];
+    for (int i = cellWindowStart[cell]; i < cellWindowStart[cell + 1]; ++i) {
+        if (++mine[cellWindows[i]] == config.winLength) wins = true;
+    }
+    for (int i = nearbyStart[cell]; i < nearbyStart[cell + 1]; ++i) {
+        ++nearbyMarks[nearbyCells[i]];
+    }
+    cells[cell] = static_cast<std::int8_t>(player);
+    hash ^= zobrist[cell * 2 + player] ^ sideKey;
+    ++marks;
+    return wins;
+}
+
+void MnkAlphaBetaAI::unplace(int cell, int player) {
+    --marks;
+    hash ^= zobrist[cell * 2 + player] ^ sideKey;
+    cells[cell] = -1;
+    for (int i = nearbyStart[cell]; i < nearbyStart[cell + 1]; ++i) {
+        --nearbyMarks[nearbyCells[i]];
+    }
+    auto& mine = windowCount[player];
+    for (int i = cellWindowStart[cell]; i < cellWindowStart[cell + 1]; ++i) {
+        --mine[cellWindows[i]];
+    }
+
+    const std::int64_t gain = placeGain(cell, player);
+    evaluation -= (player == 0) ? gain : -gain;
+}
+
+void MnkAlphaBetaAI::generateMoves(int player, int firstMove, std::vector<int>& out) const {
+    // Score = own gain + gain denied to the opponent
+    std::vector<std::pair<std::int64_t, int>> scored;
+    scored.reserve(cells.size());
+    for (int cell = 0; cell < static_cast<int>(cells.size()); ++cell) {
+        if (cells[cell] != -1 || nearbyMarks[cell] == 0) continue;
+        std::int64_t score = placeGain(cell, player) + placeGain(cell, 1 - player);
+        if (cell == firstMove) score = Infinity;
+        scored.push_back({score, cell});
+    }
+
+    std::sort(scored.begin(), scored.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first || (a.first == b.first && a.second < b.second);
+    });
+    if (config.maxCandidates > 0 && static_cast<int>(scored.size()) > config.maxCandidates) {
+        scored.resize(config.maxCandidates);
+    }
+
+    out.clear();
+    for (const auto& entry : scored) out.push_back(entry.second);
+}
+
+std::int64_t MnkAlphaBetaAI::negamax(int depth, std::int64_t alpha, std::int64_t beta, int player, int ply) {
+    ++stats.nodes;
+    if ((stats.nodes & 1023) == 0 && Clock::now() >= deadline) {
+        aborted = true;
+    }
+    if (aborted) {
+        return 0;
+    }
+
+    const std::int64_t originalAlpha = alpha;
+    TableEntry& entry = table[hash & (table.size() - 1)];
+    int tableMove = -1;
+    if (entry.key == hash) {
+        tableMove = entry.move;
+        if (entry.depth >= depth) {
+            ++stats.tableHits;
+            if (entry.bound == Bound::Exact) return entry.score;
+            if (entry.bound == Bound::Lower) alpha = std::max(alpha, entry.score);
+            if (entry.bound == Bound::Upper) beta = std::min(beta, entry.score);
+            if (alpha >= beta) return entry.score;
+        }
+    }
+
+    if (depth == 0) {
+        return (player == 0) ? evaluation : -evaluation;
+    }
+    if (marks == static_cast<int>(cells.size())) {
+        return 0;  // Draw
+    }
+
+    if (static_cast<int>(moveBuffers.size()) <= ply) {
+        moveBuffers.resize(ply + 1);
+    }
+    std::vector<int>& moves = moveBuffers[ply];
+    generateMoves(player, tableMove, moves);
+
+    std::int64_t best = -Infinity;
+    int bestMove = -1;
+    for (size_t i = 0; i < moves.size(); ++i) {
+        const int move = moves[i];  // moves may be reallocated by deeper plies
+        const bool wins = place(move, player);
+        const std::int64_t score = wins ? WinScore - ply
+                                        : -negamax(depth - 1, -beta, -alpha, 1 - player, ply + 1);
+        unplace(move, player);
+        if (aborted) {
+            return 0;
+        }
+        if (score > best) {
+            best = score;
+            bestMove = move;
+        }
+        alpha = std::max(alpha, score);
+        if (alpha >= beta) break;
+    }
+
+    entry.key = hash;
+    entry.score = best;
+    entry.move = bestMove;
+    entry.depth = static_cast<std::int16_t>(depth);
+    entry.bound = (best <= originalAlpha) ? Bound::Upper : (best >= beta) ? Bound::Lower : Bound::Exact;
+    return best;
+}
+
+int MnkAlphaBetaAI::chooseMove(const Grid<char>& board, char symbol) {
+    stats = SearchStats();
+    const int r = static_cast<int>(board.getRows());
+    const int c = static_cast<int>(board.getCols());
+    if (r != rows || c != cols || zobrist.empty()) {
+        setupGeometry(r, c);
+    }
+
+    // Load the position
+    const int cellCount = rows * cols;
+    cells.assign(cellCount, -1);
+    nearbyMarks.assign(cellCount, 0);
+    std::fill(windowCount[0].begin(), windowCount[0].end(), 0);
+    std::fill(windowCount[1].begin(), windowCount[1].end(), 0);
+    evaluation = 0;
+    hash = 0;
+    marks = 0;
+    for (int cell = 0; cell < cellCount; ++cell) {
+        const char mark = board.at(cell / cols, cell % cols);
+        if (mark != ' ') {
+            place(cell, mark == 'X' ? 0 : 1);
+        }
+    }
+    if (marks == cellCount) {
+        return -1;
+    }
+    // The hash toggles the side key per mark; pin it to the side actually moving
+    const int player = (symbol == 'X') ? 0 : 1;
+    if ((marks % 2 == 1) != (player == 1)) {
+        hash ^= sideKey;
+    }
+    if (marks == 0) {
+        return (rows / 2) * cols + cols / 2;  // Open in the centre
+    }
+
+    deadline = Clock::now() + std::chrono::milliseconds(config.timeLimitMs);
+    aborted = false;
+
+    std::vector<int> rootMoves;
+    generateMoves(player, -1, rootMoves);
+    int bestMove = rootMoves.empty() ? -1 : rootMoves.front();
+    const int maxDepth = std::min(config.maxDepth, cellCount - marks);
+
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        std::int64_t alpha = -Infinity;
+        int depthBest = -1;
+        for (int move : rootMoves) {
+            const bool wins = place(move, player);
+            const std::int64_t score = wins ? WinScore
+                                            : -negamax(depth - 1, -Infinity, -alpha, 1 - player, 1);
+            unplace(move, player);
+            if (aborted) break;
+            if (score > alpha) {
+                alpha = score;
+                depthBest = move;
+            }
+        }
+        if (aborted || depthBest < 0) {
+            break;
+        }
+
+        bestMove = depthBest;
+        stats.completedDepth = depth;
+        stats.score = alpha;
+        if (isDecisive(alpha)) {
+            break;
+        }
+        // Search the best move first on the next iteration
+        std::rotate(rootMoves.begin(), std::find(rootMoves.begin(), rootMoves.end(), bestMove),
+                    std::find(rootMoves.begin(), rootMoves.end(), bestMove) + 1);
+    }
+    return bestMove;
+}
@@ -0,0 +1,182 @@
+#include "../include/ai/Puzzle2048ExpectimaxAI.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+using Bits = Board2048::Bits;
+
+constexpr Board2048::Direction AllDirections[] = {
+    Board2048::Direction::Left, Board2048::Direction::Right,
+    Board2048::Direction::Up, Board2048::Direction::Down
+};
+
+/**
+ * Per-row heuristic values for all 65536 rows
+ * Rewards empty cells, adjacent equal tiles and monotonic rows;
+ * penalizes large scattered tiles.
+ */
+struct HeuristicTable {
+    std::array<float, 65536> rowScore;
+
+    HeuristicTable() {
+        const float lostPenalty = 200000.0f;
+        const float monotonicityPower = 4.0f;
+        const float monotonicityWeight = 47.0f;
+        const float sumPower = 3.5f;
+        const float sumWeight = 11.0f;
+        const float mergesWeight = 700.0f;
+        const float emptyWeight = 270.0f;
+
+        for (std::uint32_t row = 0; row < 65536; ++row) {
+            int line[4] = {
+                static_cast<int>(row & 0xF),
+                static_cast<int>((row >> 4) & 0xF),
+                static_cast<int>((row >> 8) & 0xF),
+                static_cast<int>((row >> 12) & 0xF)
+            };
+
+            float sum = 0.f;
+            int empty = 0;
+            int merges = 0;
+            int prev = 0;
+            int counter = 0;
+            for (int rank : line) {
+                sum += std::pow(static_cast<float>(rank), sumPower);
+                if (rank == 0) {
+                    ++empty;
+                } else {
+                    if (prev == rank) {
+                        ++counter;
+                    } else if (counter > 0) {
+                        merges += 1 + counter;
+                        counter = 0;
+                    }
+                    prev = rank;
+                }
+            }
+            if (counter > 0) {
+                merges += 1 + counter;
+            }
+
+            float monotonicityLeft = 0.f;
+            float monotonicityRight = 0.f;
+            for (int i = 1; i < 4; ++i) {
+                const float a = std::pow(static_cast<float>(line[i - 1]), monotonicityPower);
+                const float b = std::pow(static_cast<float>(line[i]), monotonicityPower);
+                if (line[i - 1] > line[i]) {
+                    monotonicityLeft += a - b;
+                } else {
+                    monotonicityRight += b - a;
+                }
+            }
+
+            rowScore[row] = lostPenalty + emptyWeight * empty + mergesWeight * merges -
+                            monotonicityWeight * std::min(monotonicityLeft, monotonicityRight) -
+                            sumWeight * sum;
+        }
+    }
+};
+
+const HeuristicTable& heuristics() {
+    static const HeuristicTable instance;
+    return instance;
+}
+}
+
+Puzzle2048ExpectimaxAI::Puzzle2048ExpectimaxAI() : Puzzle2048ExpectimaxAI(Config()) {}
+
+Puzzle2048ExpectimaxAI::Puzzle2048ExpectimaxAI(const Config& cfg) : config(cfg) {
+    if (config.cacheBits > 0) {
+        cache.resize(size_t(1) << config.cacheBits);
+        cacheShift = 64 - config.cacheBits;
+    }
+}
+
+float Puzzle2048ExpectimaxAI::evaluate(Bits board) {
+    const HeuristicTable& h = heuristics();
+    const Bits transposed = Board2048::transpose(board);
+    return h.rowScore[board & 0xFFFF] + h.rowScore[(board >> 16) & 0xFFFF] +
+           h.rowScore[(board >> 32) & 0xFFFF] + h.rowScore[(board >> 48) & 0xFFFF] +
+           h.rowScore[transposed & 0xFFFF] + h.rowScore[(transposed >> 16) & 0xFFFF] +
+           h.rowScore[(transposed >> 32) & 0xFFFF] + h.rowScore[(transposed >> 48) & 0xFFFF];
+}
+
+float Puzzle2048ExpectimaxAI::scoreMoveNode(Bits board, float probability, int depth) {
+    float best = 0.f;
+    for (Board2048::Direction dir : AllDirections) {
+        const Bits next = Board2048::shift(board, dir);
+        if (next == board) continue;
+        best = std::max(best, scoreChanceNode(next, probability, depth + 1));
+    }
+    return best;
+}
+
+float Puzzle2048ExpectimaxAI::scoreChanceNode(Bits board, float probability, int depth) {
+    ++stats.nodes;
+    if (depth >= config.depth || probability < config.probabilityCutoff) {
+        return evaluate(board);
+    }
+
+    CacheEntry* entry = nullptr;
+    if (!cache.empty()) {
+        // Fibonacci hashing spreads the packed board across the table
+        entry = &cache[(board * 0x9E3779B97F4A7C15ULL) >> cacheShift];
+        if (entry->generation == generation && entry->board == board && entry->depth <= depth) {
+            ++stats.cacheHits;
+            return entry->score;
+        }
+    }
+
+    const std::uint16_t emptyMask = Board2048(board).getEmptyMask();
+    const int emptyCount = Board2048(board).countEmpty();
+    const float cellProbability = probability / emptyCount;
+
+    float total = 0.f;
+    for (int i = 0; i < 16; ++i) {
+        if (!(emptyMask & (1u << i))) continue;
+        const Bits two = board | (Bits(1) << (i * 4));
+        const Bits four = board | (Bits(2) << (i * 4));
+        total += scoreMoveNode(two, cellProbability * 0.9f, depth) * 0.9f;
+        total += scoreMoveNode(four, cellProbability * 0.1f, depth) * 0.1f;
+    }
+    total /= emptyCount;
+
+    if (entry) {
+        entry->board = board;
+        entry->score = total;
+        entry->depth = depth;
+        entry->generation = generation;
+    }
+    return total;
+}
+
+std::optional<Board2048::Direction> Puzzle2048ExpectimaxAI::chooseMove(const Board2048& board) {
+    stats = SearchStats();
+    if (++generation == 0) {
+        // Counter wrapped: drop stale entries that could alias the new generation
+        std::fill(cache.begin(), cache.end(), CacheEntry());
+        generation = 1;
+    }
+
+    std::optional<Board2048::Direction> bestMove;
+    float bestScore = -1.f;
+    for (Board2048::Direction dir : AllDirections) {
+        const Bits next = Board2048::shift(board.raw(), dir);
+        if (next == board.raw()) continue;
+        const float score = scoreChanceNode(next, 1.0f, 0);
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = dir;
+        }
+    }
+    return bestMove;
+}
+
+void Puzzle2048ExpectimaxAI::makeMove(Board2048& board, char /*symbol*/) {
+    auto dir = chooseMove(board);
+    if (dir) {
+        int gained = 0;
+        board.move(*dir, gained);
+    }
+}
@@ -0,0 +1,77 @@
+#include "../include/ai/Puzzle2048MctsAI.hpp"
+
+namespace {
+constexpr Board2048::Direction AllDirections[] = {
+    Board2048::Direction::Left, Board2048::Direction::Right,
+    Board2048::Direction::Up, Board2048::Direction::Down
+};
+}
+
+void Puzzle2048MctsAI::Model::legalMoves(const State& state, std::vector<int>& moves) {
+    moves.clear();
+    for (Board2048::Direction dir : AllDirections) {
+        if (Board2048::shift(state.board.raw(), dir) != state.board.raw()) {
+            moves.push_back(static_cast<int>(dir));
+        }
+    }
+}
+
+void Puzzle2048MctsAI::Model::play(State& state, int move, std::mt19937& rng) {
+    int gained = 0;
+    state.board.move(static_cast<Board2048::Direction>(move), gained);
+    state.score += gained;
+
+    // Spawn a tile in a random empty cell: 2 (90%) or 4 (10%)
+    std::uint16_t emptyMask = state.board.getEmptyMask();
+    const int emptyCount = state.board.countEmpty();
+    if (emptyCount == 0) return;
+    for (int skip = static_cast<int>(rng() % emptyCount); skip > 0; --skip) {
+        emptyMask &= emptyMask - 1;
+    }
+    int cell = 0;
+    while (!(emptyMask & (1u << cell))) ++cell;
+    state.board.setExponent(cell / 4, cell % 4, (rng() % 10 == 0) ? 2 : 1);
+}
+
+double Puzzle2048MctsAI::Model::reward(const State& end, const State& root, int /*player*/) {
+    const double gained = end.score - root.score;
+    return gained / (gained + 2048.0);
+}
+
+int Puzzle2048MctsAI::Model::rolloutMove(const State& state, const std::vector<int>& moves, MctsRollout policy,
+                                         std::mt19937& rng) {
+    if (policy == MctsRollout::Heuristic) {
+        int best = -1;
+        int bestEmpty = -1;
+        const size_t offset = rng() % moves.size();   // Random tie-break
+        for (size_t i = 0; i < moves.size(); ++i) {
+            const int move = moves[(i + offset) % moves.size()];
+            const int empty = Board2048(Board2048::shift(state.board.raw(),
+                                        static_cast<Board2048::Direction>(move))).countEmpty();
+            if (empty > bestEmpty) {
+                bestEmpty = empty;
+                best = move;
+            }
+        }
+        return best;
+    }
+    return moves[rng() % moves.size()];
+}
+
+std::optional<Board2048::Direction> Puzzle2048MctsAI::chooseMove(const Board2048& board) {
+    Model::State root;
+    root.board = board;
+    const int move = search.search(root);
+    if (move < 0) {
+        return std::nullopt;
+    }
+    return static_cast<Board2048::Direction>(move);
+}
+
+void Puzzle2048MctsAI::makeMove(Board2048& board, char /*symbol*/) {
+    auto dir = chooseMove(board);
+    if (dir) {
+        int gained = 0;
+        board.move(*dir, gained);
+    }
+}
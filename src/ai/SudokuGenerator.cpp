@@ -0,0 +1,117 @@
+#include "../include/ai/SudokuGenerator.hpp"
+#include "../include/util/WorkStealingPool.hpp"
+#include <algorithm>
+#include <numeric>
+
+namespace {
+// Clue floors cycled across attempts; high floors yield easy puzzles,
+// digging to the minimum yields hard ones
+constexpr int ClueFloors[] = {40, 34, 30, 26, 17, 17};
+constexpr size_t ClueFloorCount = sizeof(ClueFloors) / sizeof(ClueFloors[0]);
+}
+
+SudokuGenerator::SudokuGenerator(std::uint64_t seed) : rng(seed) {}
+
+SudokuGenerator::Puzzle SudokuGenerator::randomSolution() {
+    // Base grid: the three diagonal boxes share no row or column, so any digit
+    // order in each can be completed; the solver fills in the rest. Unlike
+    // a fixed pattern grid, this draws from many symmetry classes.
+    std::array<int, 9> digits;
+    std::iota(digits.begin(), digits.end(), 1);
+    Puzzle seeded{};
+    for (int box = 0; box < 3; ++box) {
+        std::shuffle(digits.begin(), digits.end(), rng);
+        for (int k = 0; k < 9; ++k) {
+            seeded[(box * 3 + k / 3) * 9 + box * 3 + k % 3] = static_cast<std::uint8_t>(digits[k]);
+        }
+    }
+    const Puzzle base = solver.solve(seeded).solution;
+
+    std::shuffle(digits.begin(), digits.end(), rng);
+
+    // Row order: shuffle bands, then rows within each band (same for columns)
+    auto lineOrder = [this]() {
+        std::array<int, 3> bands = {0, 1, 2};
+        std::shuffle(bands.begin(), bands.end(), rng);
+        std::array<int, 9> order;
+        for (int b = 0; b < 3; ++b) {
+            std::array<int, 3> lines = {0, 1, 2};
+            std::shuffle(lines.begin(), lines.end(), rng);
+            for (int k = 0; k < 3; ++k) order[b * 3 + k] = bands[b] * 3 + lines[k];
+        }
+        return order;
+    };
+    const std::array<int, 9> rows = lineOrder();
+    const std::array<int, 9> cols = lineOrder();
+    const bool transposed = (rng() & 1) != 0;
+
+    Puzzle grid{};
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            const int src = transposed ? cols[c] * 9 + rows[r] : rows[r] * 9 + cols[c];
+            grid[r * 9 + c] = static_cast<std::uint8_t>(digits[base[src] - 1]);
+        }
+    }
+    return grid;
+}
+
+SudokuGenerator::GeneratedPuzzle SudokuGenerator::generate(int minClues) {
+    GeneratedPuzzle result;
+    result.puzzle = randomSolution();
+
+    std::array<int, 81> order;
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), rng);
+
+    for (int idx : order) {
+        if (result.clues <= minClues) break;
+        const std::uint8_t saved = result.puzzle[idx];
+        result.puzzle[idx] = 0;
+        if (solver.hasUniqueSolution(result.puzzle)) {
+            --result.clues;
+        } else {
+            result.puzzle[idx] = saved;
+        }
+    }
+
+    result.difficulty = SudokuSolver::grade(result.puzzle);
+    return result;
+}
+
+std::array<std::vector<SudokuGenerator::Puzzle>, SudokuSolver::DifficultyCount>
+SudokuGenerator::generateBatch(const BatchConfig& config, WorkStealingPool& pool) {
+    std::array<std::vector<Puzzle>, SudokuSolver::DifficultyCount> buckets;
+    auto unfilled = [&]() {
+        for (int d = 0; d < SudokuSolver::DifficultyCount; ++d) {
+            if (buckets[d].size() < config.targets[d]) return true;
+        }
+        return false;
+    };
+
+    // Rounds of independent attempts; results are bucketed in attempt order
+    // so the output does not depend on thread scheduling
+    const size_t roundSize = pool.getThreadCount() * 8;
+    std::vector<GeneratedPuzzle> round(roundSize);
+    size_t attempt = 0;
+    while (unfilled() && attempt < config.maxAttempts) {
+        const size_t first = attempt;
+        const size_t count = std::min(roundSize, config.maxAttempts - attempt);
+        for (size_t i = 0; i < count; ++i) {
+            pool.submit([&round, &config, first, i]() {
+                const size_t index = first + i;
+                SudokuGenerator generator(config.seed + index);
+                round[i] = generator.generate(ClueFloors[index % ClueFloorCount]);
+            });
+        }
+        pool.wait();
+        attempt += count;
+
+        for (size_t i = 0; i < count; ++i) {
+            auto& bucket = buckets[static_cast<int>(round[i].difficulty)];
+            if (bucket.size() < config.targets[static_cast<int>(round[i].difficulty)]) {
+                bucket.push_back(round[i].puzzle);
+            }
+        }
+    }
+    return buckets;
+}
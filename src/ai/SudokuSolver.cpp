@@ -0,0 +1,440 @@
+#include "../include/ai/SudokuSolver.hpp"
+#include <utility>
+
+namespace {
+constexpr std::uint16_t AllDigits = 0x1FF;
+
+/**
+ * Cell/unit lookup tables (units 0-8 rows, 9-17 columns, 18-26 boxes)
+ */
+struct UnitTables {
+    std::uint8_t cellUnits[81][3];
+    std::uint8_t unitCells[27][9];
+
+    UnitTables() {
+        int fill[27] = {0};
+        for (int idx = 0; idx < 81; ++idx) {
+            const int r = idx / 9;
+            const int c = idx % 9;
+            const int units[3] = {r, 9 + c, 18 + (r / 3) * 3 + c / 3};
+            for (int k = 0; k < 3; ++k) {
+                cellUnits[idx][k] = static_cast<std::uint8_t>(units[k]);
+                unitCells[units[k]][fill[units[k]]++] = static_cast<std::uint8_t>(idx);
+            }
+        }
+    }
+};
+
+const UnitTables& unitTables() {
+    static const UnitTables instance;
+    return instance;
+}
+
+int popcount(std::uint16_t mask) {
+    int count = 0;
+    for (; mask != 0; mask &= mask - 1) ++count;
+    return count;
+}
+
+int digitFromBit(std::uint16_t bit) {
+    int digit = 1;
+    while (bit > 1) {
+        bit >>= 1;
+        ++digit;
+    }
+    return digit;
+}
+
+/**
+ * Search state for the propagation backend; small enough to copy per branch
+ */
+struct PropagationState {
+    std::uint8_t cells[81];
+    std::uint16_t used[27];
+    int filled;
+};
+
+std::uint16_t candidatesFor(const PropagationState& s, const UnitTables& t, int idx) {
+    const std::uint8_t* units = t.cellUnits[idx];
+    return static_cast<std::uint16_t>(~(s.used[units[0]] | s.used[units[1]] | s.used[units[2]]) & AllDigits);
+}
+
+bool assign(PropagationState& s, const UnitTables& t, int idx, int digit) {
+    const std::uint16_t bit = static_cast<std::uint16_t>(1u << (digit - 1));
+    const std::uint8_t* units = t.cellUnits[idx];
+    if ((s.used[units[0]] | s.used[units[1]] | s.used[units[2]]) & bit) {
+        return false;
+    }
+    s.used[units[0]] |= bit;
+    s.used[units[1]] |= bit;
+    s.used[units[2]] |= bit;
+    s.cells[idx] = static_cast<std::uint8_t>(digit);
+    ++s.filled;
+    return true;
+}
+
+/**
+ * Apply naked (and optionally hidden) singles until nothing changes
+ * @return false if a contradiction was found
+ */
+bool propagate(PropagationState& s, const UnitTables& t, bool hiddenSingles = true) {
+    bool progress = true;
+    while (progress && s.filled < 81) {
+        progress = false;
+
+        // Naked singles: cells with exactly one candidate
+        for (int idx = 0; idx < 81; ++idx) {
+            if (s.cells[idx] != 0) continue;
+            const std::uint16_t candidates = candidatesFor(s, t, idx);
+            if (candidates == 0) return false;
+            if ((candidates & (candidates - 1)) == 0) {
+                if (!assign(s, t, idx, digitFromBit(candidates))) return false;
+                progress = true;
+            }
+        }
+
+        // Hidden singles: digits with exactly one possible cell in a unit
+        for (int unit = 0; hiddenSingles && unit < 27; ++unit) {
+            std::uint16_t once = 0;
+            std::uint16_t twice = 0;
+            for (int k = 0; k < 9; ++k) {
+                const int idx = t.unitCells[unit][k];
+                if (s.cells[idx] != 0) continue;
+                const std::uint16_t candidates = candidatesFor(s, t, idx);
+                twice |= once & candidates;
+                once |= candidates;
+            }
+            if ((once | s.used[unit]) != AllDigits) return false;  // Some digit has nowhere to go
+
+            std::uint16_t singles = static_cast<std::uint16_t>(once & ~twice);
+            while (singles != 0) {
+                const std::uint16_t bit = static_cast<std::uint16_t>(singles & (~singles + 1));
+                singles &= static_cast<std::uint16_t>(singles - 1);
+                int target = -1;
+                for (int k = 0; k < 9; ++k) {
+                    const int idx = t.unitCells[unit][k];
+                    if (s.cells[idx] == 0 && (candidatesFor(s, t, idx) & bit)) {
+                        target = idx;
+                        break;
+                    }
+                }
+                if (target < 0 || !assign(s, t, target, digitFromBit(bit))) return false;
+                progress = true;
+            }
+        }
+    }
+    return true;
+}
+
+void searchPropagation(PropagationState& s, const UnitTables& t, int limit, SudokuSolver::Result& result) {
+    if (!propagate(s, t)) return;
+
+    if (s.filled == 81) {
+        if (result.solutionCount == 0) {
+            for (int idx = 0; idx < 81; ++idx) result.solution[idx] = s.cells[idx];
+        }
+        ++result.solutionCount;
+        return;
+    }
+
+    // Branch on the cell with the fewest candidates
+    int bestIdx = -1;
+    int bestCount = 10;
+    std::uint16_t bestCandidates = 0;
+    for (int idx = 0; idx < 81 && bestCount > 2; ++idx) {
+        if (s.cells[idx] != 0) continue;
+        const std::uint16_t candidates = candidatesFor(s, t, idx);
+        const int count = popcount(candidates);
+        if (count < bestCount) {
+            bestCount = count;
+            bestIdx = idx;
+            bestCandidates = candidates;
+        }
+    }
+
+    for (std::uint16_t remaining = bestCandidates; remaining != 0; remaining &= remaining - 1) {
+        const std::uint16_t bit = static_cast<std::uint16_t>(remaining & (~remaining + 1));
+        PropagationState next = s;
+        ++result.guesses;
+        if (assign(next, t, bestIdx, digitFromBit(bit))) {
+            searchPropagation(next, t, limit, result);
+        }
+        if (result.solutionCount >= limit) return;
+    }
+}
+}
+
+/**
+ * Algorithm X with dancing links over the Sudoku exact cover matrix
+ * 324 columns (cell, row-digit, column-digit, box-digit) and 729 rows
+ * (one per cell/digit pair). Givens are covered before the search and
+ * uncovered afterwards, so the matrix is built only once.
+ */
+class SudokuSolver::DancingLinks {
+private:
+    static constexpr int ColumnCount = 324;
+    static constexpr int RowCount = 729;
+    static constexpr int Root = 0;
+
+    std::vector<int> left, right, up, down, column, rowOf;
+    std::vector<int> size;
+    std::vector<int> rowFirstNode;
+    std::vector<bool> columnCovered;
+    std::vector<int> chosenRows;
+
+    void cover(int c) {
+        right[left[c]] = right[c];
+        left[right[c]] = left[c];
+        for (int i = down[c]; i != c; i = down[i]) {
+            for (int j = right[i]; j != i; j = right[j]) {
+                up[down[j]] = up[j];
+                down[up[j]] = down[j];
+                --size[column[j]];
+            }
+        }
+        columnCovered[c] = true;
+    }
+
+    void uncover(int c) {
+        for (int i = up[c]; i != c; i = up[i]) {
+            for (int j = left[i]; j != i; j = left[j]) {
+                ++size[column[j]];
+                up[down[j]] = j;
+                down[up[j]] = j;
+            }
+        }
+        right[left[c]] = c;
+        left[right[c]] = c;
+        columnCovered[c] = false;
+    }
+
+    void search(int limit, const Puzzle& puzzle, Result& result) {
+        if (right[Root] == Root) {
+            if (result.solutionCount == 0) {
+                result.solution = puzzle;
+                for (int row : chosenRows) {
+                    result.solution[row / 9] = static_cast<std::uint8_t>(row % 9 + 1);
+                }
+            }
+            ++result.solutionCount;
+            return;
+        }
+
+        int best = right[Root];
+        for (int c = right[best]; c != Root; c = right[c]) {
+            if (size[c] < size[best]) best = c;
+        }
+        if (size[best] == 0) return;
+
+        cover(best);
+        for (int r = down[best]; r != best; r = down[r]) {
+            if (size[best] > 1) ++result.guesses;
+            chosenRows.push_back(rowOf[r]);
+            for (int j = right[r]; j != r; j = right[j]) cover(column[j]);
+            search(limit, puzzle, result);
+            for (int j = left[r]; j != r; j = left[j]) uncover(column[j]);
+            chosenRows.pop_back();
+            if (result.solutionCount >= limit) break;
+        }
+        uncover(best);
+    }
+
+public:
+    DancingLinks() {
+        const int nodeCount = 1 + ColumnCount + RowCount * 4;
+        left.resize(nodeCount);
+        right.resize(nodeCount);
+        up.resize(nodeCount);
+        down.resize(nodeCount);
+        column.resize(nodeCount);
+        rowOf.assign(nodeCount, -1);
+        size.assign(1 + ColumnCount, 0);
+        rowFirstNode.resize(RowCount);
+        columnCovered.assign(1 + ColumnCount, false);
+        chosenRows.reserve(81);
+
+        for (int c = 0; c <= ColumnCount; ++c) {
+            left[c] = (c == 0) ? ColumnCount : c - 1;
+            right[c] = (c == ColumnCount) ? 0 : c + 1;
+            up[c] = down[c] = c;
+            column[c] = c;
+        }
+
+        int node = ColumnCount + 1;
+        for (int row = 0; row < RowCount; ++row) {
+            const int cell = row / 9;
+            const int digit = row % 9;
+            const int r = cell / 9;
+            const int c = cell % 9;
+            const int b = (r / 3) * 3 + c / 3;
+            const int columns[4] = {
+                1 + cell,
+                1 + 81 + r * 9 + digit,
+                1 + 162 + c * 9 + digit,
+                1 + 243 + b * 9 + digit
+            };
+
+            rowFirstNode[row] = node;
+            for (int k = 0; k < 4; ++k) {
+                const int col = columns[k];
+                column[node] = col;
+                rowOf[node] = row;
+                // Append at the bottom of the column
+                up[node] = up[col];
+                down[node] = col;
+                down[up[col]] = node;
+                up[col] = node;
+                ++size[col];
+                // Link into the row's circular list
+                left[node] = (k == 0) ? node + 3 : node - 1;
+                right[node] = (k == 3) ? node - 3 : node + 1;
+                ++node;
+            }
+        }
+    }
+
+    Result solve(const Puzzle& puzzle, int limit) {
+        Result result;
+        std::vector<int> coveredGivens;
+        coveredGivens.reserve(81 * 4);
+        bool consistent = true;
+
+        for (int cell = 0; cell < 81 && consistent; ++cell) {
+            if (puzzle[cell] == 0) continue;
+            if (puzzle[cell] > 9) {
+                consistent = false;
+                break;
+            }
+            const int first = rowFirstNode[cell * 9 + puzzle[cell] - 1];
+            int j = first;
+            do {
+                if (columnCovered[column[j]]) {
+                    consistent = false;  // Two givens claim the same constraint
+                    break;
+                }
+                cover(column[j]);
+                coveredGivens.push_back(column[j]);
+                j = right[j];
+            } while (j != first);
+        }
+
+        if (consistent) {
+            search(limit, puzzle, result);
+        }
+
+        for (auto it = coveredGivens.rbegin(); it != coveredGivens.rend(); ++it) {
+            uncover(*it);
+        }
+        return result;
+    }
+};
+
+SudokuSolver::SudokuSolver(Backend b) : backend(b) {
+    if (backend == Backend::DancingLinks) {
+        dlx = std::make_unique<DancingLinks>();
+    }
+}
+
+SudokuSolver::~SudokuSolver() = default;
+SudokuSolver::SudokuSolver(SudokuSolver&&) noexcept = default;
+SudokuSolver& SudokuSolver::operator=(SudokuSolver&&) noexcept = default;
+
+SudokuSolver::Result SudokuSolver::solve(const Puzzle& puzzle, int solutionLimit) {
+    if (backend == Backend::DancingLinks) {
+        return dlx->solve(puzzle, solutionLimit);
+    }
+
+    const UnitTables& t = unitTables();
+    Result result;
+    PropagationState state{};
+    for (int idx = 0; idx < 81; ++idx) {
+        const int digit = puzzle[idx];
+        if (digit == 0) continue;
+        if (digit > 9 || !assign(state, t, idx, digit)) {
+            return result;  // Givens contradict each other
+        }
+    }
+    searchPropagation(state, t, solutionLimit, result);
+    return result;
+}
+
+SudokuSolver::Difficulty SudokuSolver::grade(const Puzzle& puzzle) {
+    const UnitTables& t = unitTables();
+    PropagationState state{};
+    for (int idx = 0; idx < 81; ++idx) {
+        const int digit = puzzle[idx];
+        if (digit != 0 && (digit > 9 || !assign(state, t, idx, digit))) {
+            return Difficulty::Expert;
+        }
+    }
+
+    PropagationState nakedOnly = state;
+    if (propagate(nakedOnly, t, false) && nakedOnly.filled == 81) {
+        return Difficulty::Easy;
+    }
+    if (propagate(state, t, true) && state.filled == 81) {
+        return Difficulty::Medium;
+    }
+
+    Result result;
+    searchPropagation(state, t, 1, result);
+    return result.guesses <= HardGuessLimit ? Difficulty::Hard : Difficulty::Expert;
+}
+
+const char* SudokuSolver::difficultyName(Difficulty difficulty) {
+    switch (difficulty) {
+        case Difficulty::Easy: return "Easy";
+        case Difficulty::Medium: return "Medium";
+        case Difficulty::Hard: return "Hard";
+        case Difficulty::Expert: return "Expert";
+    }
+    return "Unknown";
+}
+
+bool SudokuSolver::hasUniqueSolution(const Puzzle& puzzle) {
+    return solve(puzzle, 2).solutionCount == 1;
+}
+
+std::vector<SudokuSolver::Result> SudokuSolver::solveBatch(const std::vector<Puzzle>& puzzles, int solutionLimit) {
+    std::vector<Result> results;
+    results.reserve(puzzles.size());
+    for (const auto& puzzle : puzzles) {
+        results.push_back(solve(puzzle, solutionLimit));
+    }
+    return results;
+}
+
+bool SudokuSolver::parse(const std::string& text, Puzzle& out) {
+    int cell = 0;
+    for (char ch : text) {
+        if (cell > 81) break;
+        if (ch >= '1' && ch <= '9') {
+            if (cell < 81) out[cell] = static_cast<std::uint8_t>(ch - '0');
+            ++cell;
+        } else if (ch == '.' || ch == '0') {
+            if (cell < 81) out[cell] = 0;
+            ++cell;
+        }
+    }
+    return cell == 81;
+}
+
+std::string SudokuSolver::format(const Puzzle& puzzle) {
+    std::string text(81, '.');
+    for (int idx = 0; idx < 81; ++idx) {
+        if (puzzle[idx] != 0) {
+            text[idx] = static_cast<char>('0' + puzzle[idx]);
+        }
+    }
+    return text;
+}
+
+SudokuSolver::Puzzle SudokuSolver::fromGrid(const Grid<int, 9, 9>& board) {
+    Puzzle puzzle{};
+    for (size_t r = 0; r < 9; ++r) {
+        for (size_t c = 0; c < 9; ++c) {
+            puzzle[r * 9 + c] = static_cast<std::uint8_t>(board(r, c));
+        }
+    }
+    return puzzle;
+}
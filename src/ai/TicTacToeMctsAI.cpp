@@ -0,0 +1,110 @@
+#include "../include/ai/TicTacToeMctsAI.hpp"
+#include "../include/games/MnkRules.hpp"
+
+namespace {
+const int Directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+/**
+ * Check whether marking (row, col) would complete a run of winLength
+ */
+bool completesLine(const Grid<char>& board, int row, int col, char mark, int winLength) {
+    const int rows = static_cast<int>(board.getRows());
+    const int cols = static_cast<int>(board.getCols());
+    for (const auto& dir : Directions) {
+        int count = 1;
+        for (int sign = -1; sign <= 1; sign += 2) {
+            int r = row + sign * dir[0];
+            int c = col + sign * dir[1];
+            while (r >= 0 && r < rows && c >= 0 && c < cols && board(r, c) == mark) {
+                ++count;
+                r += sign * dir[0];
+                c += sign * dir[1];
+            }
+        }
+        if (count >= winLength) return true;
+    }
+    return false;
+}
+
+/**
+ * Find an empty cell on a line through `from` that completes a run of mark
+ * @return Cell index, or -1
+ */
+int findCompletingCell(const Grid<char>& board, int from, char mark, int winLength) {
+    if (from < 0) return -1;
+    const int rows = static_cast<int>(board.getRows());
+    const int cols = static_cast<int>(board.getCols());
+    const int row = from / cols;
+    const int col = from % cols;
+    for (const auto& dir : Directions) {
+        for (int step = -(winLength - 1); step <= winLength - 1; ++step) {
+            const int r = row + step * dir[0];
+            const int c = col + step * dir[1];
+            if (r < 0 || r >= rows || c < 0 || c >= cols || board(r, c) != ' ') continue;
+            if (completesLine(board, r, c, mark, winLength)) {
+                return r * cols + c;
+            }
+        }
+    }
+    return -1;
+}
+}
+
+void TicTacToeMctsAI::Model::legalMoves(const State& state, std::vector<int>& moves) {
+    moves.clear();
+    const int cols = static_cast<int>(state.board.getCols());
+    const int cells = static_cast<int>(state.board.getRows()) * cols;
+    for (int cell = 0; cell < cells; ++cell) {
+        if (state.board(cell / cols, cell % cols) == ' ') {
+            moves.push_back(cell);
+        }
+    }
+}
+
+void TicTacToeMctsAI::Model::play(State& state, int move, std::mt19937& /*rng*/) {
+    const int cols = static_cast<int>(state.board.getCols());
+    const int row = move / cols;
+    const int col = move % cols;
+    state.board(row, col) = state.toMove;
+    --state.empty;
+    state.lastMove[playerToMove(state)] = move;
+    if (MnkRules::findWin(state.board, row, col, state.winLength)) {
+        state.winner = state.toMove;
+    }
+    state.toMove = (state.toMove == 'X') ? 'O' : 'X';
+}
+
+double TicTacToeMctsAI::Model::reward(const State& end, const State& /*root*/, int player) {
+    if (end.winner == ' ') {
+        return 0.5;
+    }
+    return ((end.winner == 'X') ? 0 : 1) == player ? 1.0 : 0.0;
+}
+
+int TicTacToeMctsAI::Model::rolloutMove(const State& state, const std::vector<int>& moves, MctsRollout policy,
+                                        std::mt19937& rng) {
+    if (policy == MctsRollout::Heuristic) {
+        const int self = playerToMove(state);
+        const char opponent = (state.toMove == 'X') ? 'O' : 'X';
+        const int win = findCompletingCell(state.board, state.lastMove[self], state.toMove, state.winLength);
+        if (win >= 0) return win;
+        const int block = findCompletingCell(state.board, state.lastMove[1 - self], opponent, state.winLength);
+        if (block >= 0) return block;
+    }
+    return moves[rng() % moves.size()];
+}
+
+TicTacToeMctsAI::TicTacToeMctsAI() : winLength(3) {}
+
+TicTacToeMctsAI::TicTacToeMctsAI(const Config& cfg) : winLength(cfg.winLength), search(cfg) {}
+
+int TicTacToeMctsAI::chooseMove(const Grid<char>& board, char symbol) {
+    Model::State root;
+    root.board = board;
+    root.winLength = winLength;
+    root.toMove = symbol;
+    for (char cell : board) {
+        if (cell == ' ') ++root.empty;
+    }
+    return search.search(root);
+}
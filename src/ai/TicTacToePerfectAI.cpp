@@ -0,0 +1,136 @@
+#include "../include/ai/TicTacToePerfectAI.hpp"
+#include <array>
+#include <cstdint>
+
+namespace {
+constexpr int StateCount = 19683;  // 3^9
+constexpr std::uint8_t NoMove = 0xF;
+
+constexpr int Pow3[9] = {1, 3, 9, 27, 81, 243, 729, 2187, 6561};
+constexpr int Lines[8][3] = {
+    {0, 1, 2}, {3, 4, 5}, {6, 7, 8},
+    {0, 3, 6}, {1, 4, 7}, {2, 5, 8},
+    {0, 4, 8}, {2, 4, 6}
+};
+
+/**
+ * Minimax results indexed by base-3 board encoding (cell i digit: 0 empty, 1 X, 2 O)
+ * Scores are from the side to move: 10 - marks for a win, negative for a loss.
+ * X moves first, so the side to move follows from the mark counts.
+ */
+struct PerfectPlayTable {
+    std::array<std::int8_t, StateCount> score{};
+    std::array<std::uint8_t, StateCount> move{};
+    std::array<bool, StateCount> visited{};
+};
+
+constexpr bool hasLine(const int (&cells)[9], int mark) {
+    for (const auto& line : Lines) {
+        if (cells[line[0]] == mark && cells[line[1]] == mark && cells[line[2]] == mark) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Memoized negamax over every position reachable from the empty board
+ */
+constexpr int solve(PerfectPlayTable& table, int (&cells)[9], int index, int toMove, int marks) {
+    if (table.visited[index]) {
+        return table.score[index];
+    }
+
+    int best = -100;
+    std::uint8_t bestMove = NoMove;
+    if (hasLine(cells, 3 - toMove)) {
+        best = marks - 10;  // The previous mover just won
+    } else if (marks == 9) {
+        best = 0;
+    } else {
+        for (int i = 0; i < 9; ++i) {
+            if (cells[i] != 0) continue;
+            cells[i] = toMove;
+            const int value = -solve(table, cells, index + toMove * Pow3[i], 3 - toMove, marks + 1);
+            cells[i] = 0;
+            if (value > best) {
+                best = value;
+                bestMove = static_cast<std::uint8_t>(i);
+            }
+        }
+    }
+
+    table.visited[index] = true;
+    table.score[index] = static_cast<std::int8_t>(best);
+    table.move[index] = bestMove;
+    return best;
+}
+
+constexpr PerfectPlayTable buildTable() {
+    PerfectPlayTable table;
+    int cells[9] = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+    solve(table, cells, 0, 1, 0);
+    return table;
+}
+
+constexpr PerfectPlayTable Table = buildTable();
+static_assert(Table.score[0] == 0, "Tic-Tac-Toe is a draw with perfect play");
+static_assert(Table.move[Pow3[0] + 2 * Pow3[3] + Pow3[1] + 2 * Pow3[4]] == 2,
+              "X completes the top row instead of blocking");
+
+/**
+ * Encode a board for the table, relabelling marks so that the player to move
+ * has the role X or O that the mark counts imply
+ * @return Table index, or -1 for boards that are not legal 3x3 positions
+ */
+int encode(const Grid<char>& board, char symbol) {
+    if (board.getRows() != 3 || board.getCols() != 3) {
+        return -1;
+    }
+
+    int mine = 0;
+    int theirs = 0;
+    for (size_t r = 0; r < 3; ++r) {
+        for (size_t c = 0; c < 3; ++c) {
+            const char cell = board(r, c);
+            if (cell == symbol) ++mine;
+            else if (cell != ' ') ++theirs;
+        }
+    }
+
+    // Equal counts: the mover plays X's role, one behind: O's role
+    int myMark;
+    if (mine == theirs) myMark = 1;
+    else if (mine + 1 == theirs) myMark = 2;
+    else return -1;
+
+    int index = 0;
+    for (int i = 0; i < 9; ++i) {
+        const char cell = board.at(i / 3, i % 3);
+        if (cell == ' ') continue;
+        index += (cell == symbol ? myMark : 3 - myMark) * Pow3[i];
+    }
+    return Table.visited[index] ? index : -1;
+}
+}
+
+int TicTacToePerfectAI::bestMove(const Grid<char>& board, char symbol) {
+    const int index = encode(board, symbol);
+    if (index < 0 || Table.move[index] == NoMove) {
+        return -1;
+    }
+    return Table.move[index];
+}
+
+int TicTacToePerfectAI::outcome(const Grid<char>& board, char symbol) {
+    const int index = encode(board, symbol);
+    if (index < 0) {
+        return 0;
+    }
+    const int score = Table.score[index];
+    return (score > 0) - (score < 0);
+}
+
+int TicTacToePerfectAI::chooseMove(const Grid<char>& board, char symbol) {
+    return bestMove(board, symbol);
+}
@@ -2,25 +2,22 @@
 #include <random>
 #include <vector>
 
-void TicTacToeRandomAI::makeMove(Grid<char>& board, char symbol) {
-    std::vector<std::pair<size_t, size_t>> emptyCells;
+int TicTacToeRandomAI::chooseMove(const Grid<char>& board, char /*symbol*/) {
+    std::vector<int> emptyCells;
     
     // Find all empty cells
     for (size_t r = 0; r < board.getRows(); ++r) {
         for (size_t c = 0; c < board.getCols(); ++c) {
-            if (board.at(r, c) == ' ') {
-                emptyCells.push_back({r, c});
+            if (board(r, c) == ' ') {
+                emptyCells.push_back(static_cast<int>(r * board.getCols() + c));
             }
         }
     }
     
-    // Make random move if possible
-    if (!emptyCells.empty()) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(0, emptyCells.size() - 1);
-        
-        auto [row, col] = emptyCells[dis(gen)];
-        board.at(row, col) = symbol;
+    // Pick a random move if possible
+    if (emptyCells.empty()) {
+        return -1;
     }
+    std::uniform_int_distribution<size_t> dis(0, emptyCells.size() - 1);
+    return emptyCells[dis(rng)];
 }
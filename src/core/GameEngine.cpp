@@ -0,0 +1,41 @@
+#include "../include/core/GameEngine.hpp"
+#include "../include/util/Replay.hpp"
+#include <atomic>
+#include <cstdint>
+#include <random>
+
+namespace {
+/**
+ * Draw a fresh session seed
+ * std::random_device is read once per process (each read costs microseconds);
+ * sessions then take SplitMix64 outputs of a shared atomic counter, so seeds
+ * stay distinct across engines and threads.
+ */
+std::uint32_t freshSeed() {
+    static std::atomic<std::uint64_t> counter([] {
+        std::random_device device;
+        return (static_cast<std::uint64_t>(device()) << 32) | device();
+    }());
+    std::uint64_t z = counter.fetch_add(0x9E3779B97F4A7C15ull, std::memory_order_relaxed) + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>(z ^ (z >> 31));
+}
+}
+
+void GameEngine::beginSession() {
+    seed = nextSeed ? *nextSeed : freshSeed();
+    nextSeed.reset();
+    rng.seed(seed);
+    if (recording) {
+        recording->seed = seed;
+        recording->settings = getSettings();
+        recording->actions.clear();
+    }
+}
+
+void GameEngine::recordAction(int action) {
+    if (recording) {
+        recording->actions.push_back(static_cast<std::uint16_t>(action));
+    }
+}
@@ -1,52 +1,160 @@
 #include "../include/core/GameManager.hpp"
+#include "../include/ui/ProfilerOverlay.hpp"
 #include <SFML/Graphics.hpp>
-#include <iomanip>
-#include <sstream>
+#include <algorithm>
+#include <cstdio>
 
-void GameManager::setGame(std::unique_ptr<Game> game) {
+void GameManager::setGame(std::unique_ptr<Game> game, const std::string& name) {
     currentGame = std::move(game);
+    currentGameName = name;
     if (currentGame) {
         currentGame->init();
     }
 }
 
-void GameManager::run() {
-    if (!currentGame) {
-        return;
-    }
-    
+void GameManager::openWindow(sf::RenderWindow& window) {
     sf::ContextSettings settings;
     settings.antialiasingLevel = 8;
-    sf::RenderWindow window(sf::VideoMode(1000, 750), currentGame->getName(), sf::Style::Default, settings);
+    window.create(sf::VideoMode(1000, 750), currentGame->getName(), sf::Style::Default, settings);
     window.setFramerateLimit(60);
+}
+
+void GameManager::beginSession() {
+    if (!currentGame) {
+        return;
+    }
+
+    // Restart the game so the whole session, from its seed, is recorded
+    recording.game = currentGameName;
+    currentGame->getEngine().setRecording(&recording);
+    currentGame->init();
+    sessionActive = true;
+    timestep.reset();
+    sessionClock.restart();
+    shownSecond = -1;
+    ensureHudFontLoaded();
+}
+
+void GameManager::endSession() {
+    if (sessionActive) {
+        currentGame->getEngine().setRecording(nullptr);
+        recording.save(ReplayFile);
+        sessionActive = false;
+    }
+    currentGame.reset();
+}
+
+void GameManager::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
+    if (currentGame) {
+        currentGame->handleEvent(event, window);
+    }
+}
+
+void GameManager::update(float dt) {
+    if (currentGame) {
+        Game& game = *currentGame;
+        timestep.advance(dt, [&game](float step) { game.update(step); });
+    }
+}
+
+void GameManager::render(sf::RenderWindow& window) {
+    if (!currentGame) {
+        return;
+    }
+    const float elapsedSeconds = getElapsedSeconds();
+    shownSecond = static_cast<int>(elapsedSeconds);
+    window.clear(sf::Color::White);
+    currentGame->render(window, timestep.getAlpha());
+    drawTimerHud(window, elapsedSeconds);
+}
+
+bool GameManager::needsRedraw() const {
+    return currentGame && (currentGame->needsRedraw() || static_cast<int>(getElapsedSeconds()) != shownSecond);
+}
+
+float GameManager::getNextDeadline() const {
+    if (!currentGame) {
+        return Game::NoDeadline;
+    }
+    // The timer HUD changes on the next whole second
+    return std::max(0.f, std::min(currentGame->getNextDeadline(), 1.f - (getElapsedSeconds() - shownSecond)));
+}
+
+void GameManager::runReplay(const Replay& replay, float actionsPerSecond) {
+    if (!currentGame) {
+        return;
+    }
+
+    sf::RenderWindow window;
+    openWindow(window);
     sf::Clock clock;
-    float elapsedSeconds = 0.f;
     ensureHudFontLoaded();
-    
-    while (window.isOpen() && !currentGame->isOver()) {
-        sf::Event event;
-        while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed) {
-                window.close();
-            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-                // Allow exiting the game immediately via ESC and return to main menu
-                window.close();
-            } else if (event.type == sf::Event::Resized) {
-                // Update view to match window size
-                sf::FloatRect visibleArea(0.f, 0.f, static_cast<float>(event.size.width), static_cast<float>(event.size.height));
-                window.setView(sf::View(visibleArea));
+    FrameProfiler& profiler = FrameProfiler::instance();
+    FrameProfiler::Loop profilerLoop(profiler, "replay");
+    ProfilerOverlay profilerOverlay(profiler);
+
+    Game& game = *currentGame;
+    ReplayPlayer player(replay, game.getEngine(), [&game]() { game.init(); });
+    timestep.reset();
+    float speed = actionsPerSecond;
+    float pendingActions = 0.f;
+    bool paused = false;
+
+    while (window.isOpen()) {
+        profiler.beginFrame();
+        {
+            FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Events);
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed) {
+                    window.close();
+                } else if (event.type == sf::Event::Resized) {
+                    sf::FloatRect visibleArea(0.f, 0.f, static_cast<float>(event.size.width), static_cast<float>(event.size.height));
+                    window.setView(sf::View(visibleArea));
+                } else if (profilerOverlay.handleEvent(event)) {
+                    continue;
+                } else if (event.type == sf::Event::KeyPressed) {
+                    switch (event.key.code) {
+                        case sf::Keyboard::Escape: window.close(); break;
+                        case sf::Keyboard::Space: paused = !paused; break;
+                        case sf::Keyboard::Up: speed = std::min(speed * 2.f, 4096.f); break;
+                        case sf::Keyboard::Down: speed = std::max(speed * 0.5f, 0.25f); break;
+                        case sf::Keyboard::Right: if (paused) player.step(); break;
+                        case sf::Keyboard::R: player.restart(); pendingActions = 0.f; break;
+                        case sf::Keyboard::End: player.runToEnd(); break;
+                        default: break;
+                    }
+                }
             }
-            currentGame->handleEvent(event, window);
         }
-        
+
         float dt = clock.restart().asSeconds();
-        elapsedSeconds += dt;
-        currentGame->update(dt);
-        
-        window.clear(sf::Color::White);
-        currentGame->render(window);
-        drawTimerHud(window, elapsedSeconds);
-        window.display();
+        {
+            FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Update);
+            if (!paused) {
+                pendingActions += dt * speed;
+                while (pendingActions >= 1.f && player.step()) {
+                    pendingActions -= 1.f;
+                }
+                if (player.isDone()) {
+                    pendingActions = 0.f;
+                }
+            }
+            timestep.advance(dt, [&game](float step) { game.update(step); });
+        }
+
+        {
+            FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Render);
+            window.clear(sf::Color::White);
+            game.render(window, timestep.getAlpha());
+            drawReplayHud(window, player, speed, paused);
+            profilerOverlay.render(window);
+        }
+        {
+            FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Display);
+            window.display();
+        }
+        profiler.endFrame();
     }
 }
 
@@ -54,13 +162,10 @@ void GameManager::ensureHudFontLoaded() {
     if (hudFontLoaded) {
         return;
     }
-    if (hudFont.loadFromFile("assets/fonts/arial.ttf")) {
-        hudFontLoaded = true;
-        return;
-    }
-    if (hudFont.loadFromFile("C:/Windows/Fonts/arial.ttf")) {
-        hudFontLoaded = true;
-    }
+    ResourceCache& cache = ResourceCache::instance();
+    hudFont = cache.acquireDefaultFont();
+    hudFontLoaded = !cache.isPlaceholder(hudFont);
+    hudTexts.setFont(*hudFont);
 }
 
 void GameManager::drawTimerHud(sf::RenderWindow& window, float elapsedSeconds) {
@@ -71,8 +176,8 @@ void GameManager::drawTimerHud(sf::RenderWindow& window, float elapsedSeconds) {
     int totalSeconds = static_cast<int>(elapsedSeconds);
     int minutes = totalSeconds / 60;
     int seconds = totalSeconds % 60;
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << minutes << ":" << std::setw(2) << seconds;
+    char timerLabel[16];
+    std::snprintf(timerLabel, sizeof(timerLabel), "%02d:%02d", minutes, seconds);
 
     const float panelWidth = 180.f;
     const float panelHeight = 50.f;
@@ -86,19 +191,44 @@ void GameManager::drawTimerHud(sf::RenderWindow& window, float elapsedSeconds) {
     panel.setOutlineColor(sf::Color(255, 215, 0));
     window.draw(panel);
 
-    sf::Text label;
-    label.setFont(hudFont);
-    label.setString("Timer");
-    label.setCharacterSize(14);
+    sf::Text& label = hudTexts.get("Timer", 14);
     label.setFillColor(sf::Color(220, 220, 220));
     label.setPosition(panel.getPosition().x + 8.f, panel.getPosition().y + 4.f);
     window.draw(label);
 
-    sf::Text timerValue;
-    timerValue.setFont(hudFont);
-    timerValue.setString(oss.str());
-    timerValue.setCharacterSize(24);
+    sf::Text& timerValue = hudTexts.get(timerLabel, 24);
     timerValue.setFillColor(sf::Color(255, 215, 0));
     timerValue.setPosition(panel.getPosition().x + 35.f, panel.getPosition().y + 20.f);
     window.draw(timerValue);
 }
+
+void GameManager::drawReplayHud(sf::RenderWindow& window, const ReplayPlayer& player, float speed, bool paused) {
+    if (!hudFontLoaded) {
+        return;
+    }
+
+    char progressLabel[64];
+    std::snprintf(progressLabel, sizeof(progressLabel), "%zu / %zu  x%g%s", player.getPosition(),
+                  player.getLength(), speed, paused ? "  (paused)" : "");
+
+    const float panelWidth = 300.f;
+    const float panelHeight = 50.f;
+    sf::Vector2f viewSize = window.getView().getSize();
+
+    sf::RectangleShape panel({panelWidth, panelHeight});
+    panel.setPosition(10.f, viewSize.y - panelHeight - 10.f);
+    panel.setFillColor(sf::Color(0, 0, 0, 130));
+    panel.setOutlineThickness(2.f);
+    panel.setOutlineColor(player.getRejected() > 0 ? sf::Color(220, 60, 60) : sf::Color(255, 215, 0));
+    window.draw(panel);
+
+    sf::Text& label = hudTexts.get(player.getRejected() > 0 ? "Replay (out of sync)" : "Replay", 14);
+    label.setFillColor(sf::Color(220, 220, 220));
+    label.setPosition(panel.getPosition().x + 8.f, panel.getPosition().y + 4.f);
+    window.draw(label);
+
+    sf::Text& progress = hudTexts.get(progressLabel, 18);
+    progress.setFillColor(sf::Color(255, 215, 0));
+    progress.setPosition(panel.getPosition().x + 8.f, panel.getPosition().y + 22.f);
+    window.draw(progress);
+}
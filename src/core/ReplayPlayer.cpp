@@ -0,0 +1,38 @@
+#include "../include/core/ReplayPlayer.hpp"
+
+ReplayPlayer::ReplayPlayer(const Replay& rec, GameEngine& eng, std::function<void()> init)
+    : replay(rec), engine(eng), reset(std::move(init)) {
+    restart();
+}
+
+ReplayPlayer::~ReplayPlayer() {
+    engine.setReplaying(false);
+}
+
+void ReplayPlayer::restart() {
+    position = 0;
+    rejected = 0;
+    engine.setReplaying(true);
+    engine.applySettings(replay.settings);
+    engine.setSeed(replay.seed);
+    if (reset) {
+        reset();
+    } else {
+        engine.init();
+    }
+}
+
+bool ReplayPlayer::step() {
+    if (isDone()) {
+        return false;
+    }
+    if (!engine.applyAction(replay.actions[position++])) {
+        ++rejected;
+    }
+    return true;
+}
+
+void ReplayPlayer::runToEnd() {
+    while (step()) {
+    }
+}
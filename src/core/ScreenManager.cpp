@@ -1,23 +1,59 @@
 #include "../include/core/ScreenManager.hpp"
 
 void ScreenManager::setScreen(std::unique_ptr<Screen> screen) {
-    currentScreen = std::move(screen);
+    pendingScreen = std::move(screen);
+}
+
+void ScreenManager::applyPendingScreen() {
+    if (pendingScreen) {
+        currentScreen = std::move(pendingScreen);
+        screenChanged = true;
+    }
 }
 
 void ScreenManager::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
+    applyPendingScreen();
     if (currentScreen) {
         currentScreen->handleEvent(event, window);
     }
 }
 
+bool ScreenManager::handleEscape() {
+    applyPendingScreen();
+    return currentScreen && currentScreen->handleEscape();
+}
+
 void ScreenManager::update(float dt) {
+    applyPendingScreen();
     if (currentScreen) {
         currentScreen->update(dt);
     }
 }
 
 void ScreenManager::render(sf::RenderWindow& window) {
+    applyPendingScreen();
     if (currentScreen) {
+        if (screenChanged) {
+            // Resize in place rather than recreating the window and its GL context
+            const sf::Vector2u size = currentScreen->getWindowSize();
+            if (window.getSize() != size) {
+                window.setSize(size);
+                window.setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y))));
+            }
+            window.setTitle(currentScreen->getWindowTitle());
+        }
         currentScreen->render(window);
     }
+    screenChanged = false;
+}
+
+bool ScreenManager::needsRedraw() const {
+    return screenChanged || pendingScreen || (currentScreen && currentScreen->needsRedraw());
+}
+
+float ScreenManager::getNextDeadline() const {
+    if (screenChanged || pendingScreen) {
+        return 0.f;
+    }
+    return currentScreen ? currentScreen->getNextDeadline() : Screen::NoDeadline;
 }
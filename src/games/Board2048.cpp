@@ -0,0 +1,201 @@
+#include "../include/games/Board2048.hpp"
+#include <array>
+
+namespace {
+using Bits = Board2048::Bits;
+
+constexpr Bits NibbleLowBits = 0x1111111111111111ULL;
+
+/**
+ * Precomputed results for every possible 16-bit row (four 4-bit exponents)
+ */
+struct MoveTables {
+    std::array<std::uint16_t, 65536> rowLeft;
+    std::array<std::uint16_t, 65536> rowRight;
+    std::array<Bits, 65536> colUp;
+    std::array<Bits, 65536> colDown;
+    std::array<std::uint32_t, 65536> rowScore;
+
+    MoveTables();
+};
+
+std::uint16_t reverseRow(std::uint16_t row) {
+    return static_cast<std::uint16_t>(((row >> 12) & 0x000F) | ((row >> 4) & 0x00F0) |
+                                      ((row << 4) & 0x0F00) | ((row << 12) & 0xF000));
+}
+
+// Spread a 16-bit row into column 0 of a packed board
+Bits unpackColumn(std::uint16_t row) {
+    const Bits r = row;
+    return (r & 0x000F) | ((r & 0x00F0) << 12) | ((r & 0x0F00) << 24) | ((r & 0xF000) << 36);
+}
+
+MoveTables::MoveTables() {
+    for (std::uint32_t row = 0; row < 65536; ++row) {
+        int line[4] = {
+            static_cast<int>(row & 0xF),
+            static_cast<int>((row >> 4) & 0xF),
+            static_cast<int>((row >> 8) & 0xF),
+            static_cast<int>((row >> 12) & 0xF)
+        };
+
+        // Slide towards index 0, merging each pair at most once
+        int merged[4] = {0, 0, 0, 0};
+        int count = 0;
+        bool canMerge = false;
+        std::uint32_t score = 0;
+        for (int i = 0; i < 4; ++i) {
+            if (line[i] == 0) continue;
+            if (canMerge && merged[count - 1] == line[i] && line[i] < Board2048::MaxExponent) {
+                ++merged[count - 1];
+                score += 1u << merged[count - 1];
+                canMerge = false;
+            } else {
+                merged[count++] = line[i];
+                canMerge = true;
+            }
+        }
+
+        const auto result = static_cast<std::uint16_t>(
+            merged[0] | (merged[1] << 4) | (merged[2] << 8) | (merged[3] << 12));
+        const auto reversedIn = reverseRow(static_cast<std::uint16_t>(row));
+
+        rowLeft[row] = result;
+        rowScore[row] = score;
+        colUp[row] = unpackColumn(result);
+        // Moving right is moving left on the mirrored row
+        rowRight[reversedIn] = reverseRow(result);
+        colDown[reversedIn] = unpackColumn(reverseRow(result));
+    }
+}
+
+const MoveTables& tables() {
+    static const MoveTables instance;
+    return instance;
+}
+
+// Bit 0 of each nibble is set when that tile is empty
+Bits emptyNibbles(Bits packed) {
+    Bits x = packed;
+    x |= x >> 2;
+    x |= x >> 1;
+    return ~x & NibbleLowBits;
+}
+
+int lowestSetBit(Bits value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int index = 0;
+    for (; (value & 1) == 0; value >>= 1) ++index;
+    return index;
+#endif
+}
+}
+
+std::uint16_t Board2048::getEmptyMask() const {
+    const Bits empty = emptyNibbles(bits);
+    std::uint16_t mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        mask |= static_cast<std::uint16_t>(((empty >> (i * 4)) & 1) << i);
+    }
+    return mask;
+}
+
+int Board2048::findEmptyCell(int n) const {
+    Bits empty = emptyNibbles(bits);   // Low bit of each empty cell's nibble
+    for (; n > 0; --n) {
+        empty &= empty - 1;            // Drop the lowest empty cell
+    }
+    return lowestSetBit(empty) / 4;
+}
+
+int Board2048::countEmpty() const {
+    const Bits empty = emptyNibbles(bits);
+    if (empty == NibbleLowBits) {
+        return 16;  // Sum below would overflow the top nibble
+    }
+    return static_cast<int>((empty * NibbleLowBits) >> 60);
+}
+
+int Board2048::getMaxExponent() const {
+    int best = 0;
+    for (Bits x = bits; x != 0; x >>= 4) {
+        const int exponent = static_cast<int>(x & 0xF);
+        if (exponent > best) best = exponent;
+    }
+    return best;
+}
+
+bool Board2048::canMove() const {
+    if (emptyNibbles(bits) != 0) return true;
+    // A full board that cannot slide left or up cannot slide right or down either
+    return shift(bits, Direction::Left) != bits || shift(bits, Direction::Up) != bits;
+}
+
+bool Board2048::move(Direction dir, int& scoreGained) {
+    const Bits next = shift(bits, dir);
+    if (next == bits) {
+        scoreGained = 0;
+        return false;
+    }
+    scoreGained = scoreFor(bits, dir);
+    bits = next;
+    return true;
+}
+
+Board2048::Bits Board2048::shift(Bits packed, Direction dir) {
+    const MoveTables& t = tables();
+    Bits result = 0;
+
+    switch (dir) {
+        case Direction::Left:
+            for (int r = 0; r < 4; ++r) {
+                result |= Bits(t.rowLeft[(packed >> (r * 16)) & 0xFFFF]) << (r * 16);
+            }
+            break;
+        case Direction::Right:
+            for (int r = 0; r < 4; ++r) {
+                result |= Bits(t.rowRight[(packed >> (r * 16)) & 0xFFFF]) << (r * 16);
+            }
+            break;
+        case Direction::Up: {
+            const Bits transposed = transpose(packed);
+            for (int c = 0; c < 4; ++c) {
+                result |= t.colUp[(transposed >> (c * 16)) & 0xFFFF] << (c * 4);
+            }
+            break;
+        }
+        case Direction::Down: {
+            const Bits transposed = transpose(packed);
+            for (int c = 0; c < 4; ++c) {
+                result |= t.colDown[(transposed >> (c * 16)) & 0xFFFF] << (c * 4);
+            }
+            break;
+        }
+    }
+
+    return result;
+}
+
+int Board2048::scoreFor(Bits packed, Direction dir) {
+    // Each run of equal tiles merges the same number of pairs whichever way
+    // it slides, so one table serves both directions along an axis
+    const Bits lines = (dir == Direction::Up || dir == Direction::Down) ? transpose(packed) : packed;
+    const MoveTables& t = tables();
+    return static_cast<int>(t.rowScore[lines & 0xFFFF] +
+                            t.rowScore[(lines >> 16) & 0xFFFF] +
+                            t.rowScore[(lines >> 32) & 0xFFFF] +
+                            t.rowScore[(lines >> 48) & 0xFFFF]);
+}
+
+Board2048::Bits Board2048::transpose(Bits packed) {
+    const Bits a1 = packed & 0xF0F00F0FF0F00F0FULL;
+    const Bits a2 = packed & 0x0000F0F00000F0F0ULL;
+    const Bits a3 = packed & 0x0F0F00000F0F0000ULL;
+    const Bits a = a1 | (a2 << 12) | (a3 >> 12);
+    const Bits b1 = a & 0xFF00FF0000FF00FFULL;
+    const Bits b2 = a & 0x00FF00FF00000000ULL;
+    const Bits b3 = a & 0x00000000FF00FF00ULL;
+    return b1 | (b2 >> 24) | (b3 << 24);
+}
@@ -0,0 +1,19 @@
+#include "../include/games/BuiltinEngines.hpp"
+#include "../include/games/TicTacToeEngine.hpp"
+#include "../include/games/SudokuEngine.hpp"
+#include "../include/games/Puzzle2048Engine.hpp"
+
+void BuiltinEngines::registerAll(EngineFactory& factory, Subject& subject) {
+    factory.registerEngine("Tic-Tac-Toe", [&subject]() {
+        return std::make_unique<TicTacToeEngine>(&subject);
+    });
+    factory.registerEngine("Gomoku", [&subject]() {
+        return std::make_unique<TicTacToeEngine>(&subject, 15, 15, 5, "Gomoku");
+    });
+    factory.registerEngine("Sudoku", [&subject]() {
+        return std::make_unique<SudokuEngine>(&subject);
+    });
+    factory.registerEngine("2048", [&subject]() {
+        return std::make_unique<Puzzle2048Engine>(&subject);
+    });
+}
@@ -0,0 +1,19 @@
+#include "../include/games/BuiltinGames.hpp"
+#include "../include/games/TicTacToeGame.hpp"
+#include "../include/games/SudokuGame.hpp"
+#include "../include/games/Puzzle2048Game.hpp"
+
+void BuiltinGames::registerAll(GameFactory& factory, Subject& subject) {
+    factory.registerGame("Tic-Tac-Toe", [&subject]() {
+        return std::make_unique<TicTacToeGame>(&subject);
+    });
+    factory.registerGame("Gomoku", [&subject]() {
+        return std::make_unique<TicTacToeGame>(&subject, 15, 15, 5, "Gomoku");
+    });
+    factory.registerGame("Sudoku", [&subject]() {
+        return std::make_unique<SudokuGame>(&subject);
+    });
+    factory.registerGame("2048", [&subject]() {
+        return std::make_unique<Puzzle2048Game>(&subject);
+    });
+}
@@ -0,0 +1,36 @@
+#include "../include/games/MnkRules.hpp"
+
+std::optional<MnkRules::WinLine> MnkRules::findWin(const Grid<char>& board, int row, int col, int winLength) {
+    const int rows = static_cast<int>(board.getRows());
+    const int cols = static_cast<int>(board.getCols());
+    const char mark = board.at(row, col);
+    if (mark == ' ') {
+        return std::nullopt;
+    }
+
+    // Horizontal, vertical, diagonal, anti-diagonal
+    static const int Directions[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+    for (const auto& dir : Directions) {
+        // Walk backwards then forwards from the move while the mark continues
+        int back = 0;
+        while (true) {
+            const int r = row - (back + 1) * dir[0];
+            const int c = col - (back + 1) * dir[1];
+            if (r < 0 || r >= rows || c < 0 || c >= cols || board(r, c) != mark) break;
+            ++back;
+        }
+        int forward = 0;
+        while (true) {
+            const int r = row + (forward + 1) * dir[0];
+            const int c = col + (forward + 1) * dir[1];
+            if (r < 0 || r >= rows || c < 0 || c >= cols || board(r, c) != mark) break;
+            ++forward;
+        }
+
+        if (back + forward + 1 >= winLength) {
+            return WinLine{row - back * dir[0], col - back * dir[1],
+                           row + forward * dir[0], col + forward * dir[1]};
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,120 @@
+#include "../include/games/Puzzle2048Engine.hpp"
+#include <cstdio>
+
+Puzzle2048Engine::Puzzle2048Engine(Subject* subj) : subject(subj) {}
+
+std::string Puzzle2048Engine::getName() const {
+    return Name;
+}
+
+void Puzzle2048Engine::init() {
+    beginSession();
+    bitboard.clear();
+    gameOver = false;
+    won = false;
+    score = 0;
+
+    spawnTile();
+    spawnTile();
+    touch();
+}
+
+void Puzzle2048Engine::spawnTile() {
+    const int emptyCount = bitboard.countEmpty();
+    if (emptyCount == 0) {
+        return;
+    }
+    const int cell = bitboard.findEmptyCell(static_cast<int>(rng.bounded(static_cast<std::uint32_t>(emptyCount))));
+    bitboard.setExponent(cell / 4, cell % 4, rng.bounded(10) == 0 ? 2 : 1);
+    touch();
+}
+
+bool Puzzle2048Engine::applyMove(Board2048::Direction dir) {
+    const Board2048 before = bitboard;
+    int gained = 0;
+    if (!bitboard.move(dir, gained)) {
+        return false;
+    }
+
+    score += gained;
+    if (bitboard.getMaxExponent() >= 11) {  // 2^11 = 2048
+        won = true;
+    }
+    touch();
+    if (subject) {
+        subject->notifyMoveMade(Name, static_cast<int>(dir), -1, -1);
+        if (gained > 0 && subject->isListening(GameEvent::Type::TileMerged)) {
+            notifyMerges(before, dir);
+        }
+    }
+    return true;
+}
+
+void Puzzle2048Engine::notifyMerges(const Board2048& before, Board2048::Direction dir) {
+    // Replay the slide of each line in the order tiles travel; the tables
+    // behind Board2048::move do not record where merges happened
+    const bool horizontal = dir == Board2048::Direction::Left || dir == Board2048::Direction::Right;
+    const bool reversed = dir == Board2048::Direction::Right || dir == Board2048::Direction::Down;
+    for (int line = 0; line < 4; ++line) {
+        int target = 0;
+        int pending = 0;  // Exponent of the last placed tile that may still merge
+        for (int i = 0; i < 4; ++i) {
+            const int pos = reversed ? 3 - i : i;
+            const int exponent = horizontal ? before.getExponent(line, pos) : before.getExponent(pos, line);
+            if (exponent == 0) {
+                continue;
+            }
+            if (exponent == pending && exponent < Board2048::MaxExponent) {
+                const int cell = reversed ? 3 - (target - 1) : target - 1;
+                subject->notifyTileMerged(Name, horizontal ? line : cell, horizontal ? cell : line,
+                                          1 << (exponent + 1));
+                pending = 0;
+            } else {
+                pending = exponent;
+                ++target;
+            }
+        }
+    }
+}
+
+bool Puzzle2048Engine::move(Board2048::Direction dir) {
+    if (gameOver || !applyMove(dir)) {
+        return false;
+    }
+    recordAction(static_cast<int>(dir));
+    spawnTile();
+    if (!bitboard.canMove()) {
+        gameOver = true;
+        if (subject) {
+            char result[32];
+            std::snprintf(result, sizeof(result), "Score: %d%s", score, won ? " (Won!)" : " (Game Over)");
+            subject->notifyGameOver(Name, result);
+        }
+    }
+    return true;
+}
+
+std::vector<int> Puzzle2048Engine::getLegalActions() const {
+    std::vector<int> actions;
+    if (gameOver) {
+        return actions;
+    }
+    for (int dir = 0; dir < 4; ++dir) {
+        auto direction = static_cast<Board2048::Direction>(dir);
+        if (Board2048::shift(bitboard.raw(), direction) != bitboard.raw()) {
+            actions.push_back(dir);
+        }
+    }
+    return actions;
+}
+
+bool Puzzle2048Engine::applyAction(int action) {
+    if (action < 0 || action > 3) {
+        return false;
+    }
+    return move(static_cast<Board2048::Direction>(action));
+}
+
+bool Puzzle2048Engine::isFinished() const {
+    return gameOver;
+}
@@ -1,267 +1,60 @@
 #include "../include/games/Puzzle2048Game.hpp"
-#include <random>
-#include <sstream>
-#include <iomanip>
 #include <cmath>
 
 Puzzle2048Game::Puzzle2048Game(Subject* subj)
-    : board(4, 4, 0), gameOver(false), won(false), subject(subj), score(0) {}
+    : engine(subj) {}
 
 std::string Puzzle2048Game::getName() const {
-    return "2048 Puzzle";
+    return engine.getName();
 }
 
 void Puzzle2048Game::init() {
-    board.reset(0);
-    gameOver = false;
-    won = false;
-    score = 0;
+    engine.init();
     gameOverTimer = 0.f;
     celebrationTimer = 0.f;
-    
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
-    
-    // Enable smooth font rendering
-    const_cast<sf::Texture&>(font.getTexture(40)).setSmooth(true);
-    
-    spawnTile();
-    spawnTile();
+    syncBoardView();
 }
 
-void Puzzle2048Game::spawnTile() {
-    std::vector<std::pair<size_t, size_t>> emptyCells;
-    
+void Puzzle2048Game::syncBoardView() {
+    const Board2048& bitboard = engine.getBitboard();
     for (size_t r = 0; r < 4; ++r) {
         for (size_t c = 0; c < 4; ++c) {
-            if (board.at(r, c) == 0) {
-                emptyCells.push_back({r, c});
-            }
+            board(r, c) = bitboard.getValue(r, c);
         }
     }
-    
-    if (!emptyCells.empty()) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> posDis(0, emptyCells.size() - 1);
-        std::uniform_int_distribution<> valDis(1, 10);
-        
-        auto [r, c] = emptyCells[posDis(gen)];
-        board.at(r, c) = (valDis(gen) == 10) ? 4 : 2;
-    }
+    refreshHint();
+    syncedVersion = engine.getVersion();
 }
 
-bool Puzzle2048Game::moveLeft() {
-    bool moved = false;
-    
-    for (size_t r = 0; r < 4; ++r) {
-        // Compress
-        int writePos = 0;
-        for (size_t c = 0; c < 4; ++c) {
-            if (board.at(r, c) != 0) {
-                if (writePos != c) {
-                    board.at(r, writePos) = board.at(r, c);
-                    board.at(r, c) = 0;
-                    moved = true;
-                }
-                writePos++;
-            }
-        }
-        
-        // Merge
-        for (size_t c = 0; c < 3; ++c) {
-            if (board.at(r, c) != 0 && board.at(r, c) == board.at(r, c + 1)) {
-                board.at(r, c) *= 2;
-                score += board.at(r, c);
-                board.at(r, c + 1) = 0;
-                moved = true;
-                
-                if (board.at(r, c) == 2048) {
-                    won = true;
-                }
-            }
-        }
-        
-        // Compress again
-        writePos = 0;
-        for (size_t c = 0; c < 4; ++c) {
-            if (board.at(r, c) != 0) {
-                if (writePos != c) {
-                    board.at(r, writePos) = board.at(r, c);
-                    board.at(r, c) = 0;
-                }
-                writePos++;
-            }
-        }
+void Puzzle2048Game::refreshHint() {
+    if (!showAIHint) {
+        return;
     }
-    
-    return moved;
-}
-
-bool Puzzle2048Game::moveRight() {
-    bool moved = false;
-    
-    for (size_t r = 0; r < 4; ++r) {
-        // Compress
-        int writePos = 3;
-        for (int c = 3; c >= 0; --c) {
-            if (board.at(r, c) != 0) {
-                if (writePos != c) {
-                    board.at(r, writePos) = board.at(r, c);
-                    board.at(r, c) = 0;
-                    moved = true;
-                }
-                writePos--;
-            }
-        }
-        
-        // Merge
-        for (int c = 3; c > 0; --c) {
-            if (board.at(r, c) != 0 && board.at(r, c) == board.at(r, c - 1)) {
-                board.at(r, c) *= 2;
-                score += board.at(r, c);
-                board.at(r, c - 1) = 0;
-                moved = true;
-                
-                if (board.at(r, c) == 2048) {
-                    won = true;
-                }
-            }
-        }
-        
-        // Compress again
-        writePos = 3;
-        for (int c = 3; c >= 0; --c) {
-            if (board.at(r, c) != 0) {
-                if (writePos != c) {
-                    board.at(r, writePos) = board.at(r, c);
-                    board.at(r, c) = 0;
-                }
-                writePos--;
-            }
-        }
+    if (!hintAI) {
+        // Shallow search keeps the hint well inside a single frame
+        Puzzle2048ExpectimaxAI::Config config;
+        config.depth = 2;
+        hintAI = std::make_unique<Puzzle2048ExpectimaxAI>(config);
     }
-    
-    return moved;
+    aiHint = hintAI->chooseMove(engine.getBitboard());
 }
 
-bool Puzzle2048Game::moveUp() {
-    bool moved = false;
-    
-    for (size_t c = 0; c < 4; ++c) {
-        // Compress
-        int writePos = 0;
-        for (size_t r = 0; r < 4; ++r) {
-            if (board.at(r, c) != 0) {
-                if (writePos != r) {
-                    board.at(writePos, c) = board.at(r, c);
-                    board.at(r, c) = 0;
-                    moved = true;
-                }
-                writePos++;
-            }
-        }
-        
-        // Merge
-        for (size_t r = 0; r < 3; ++r) {
-            if (board.at(r, c) != 0 && board.at(r, c) == board.at(r + 1, c)) {
-                board.at(r, c) *= 2;
-                score += board.at(r, c);
-                board.at(r + 1, c) = 0;
-                moved = true;
-                
-                if (board.at(r, c) == 2048) {
-                    won = true;
-                }
-            }
-        }
-        
-        // Compress again
-        writePos = 0;
-        for (size_t r = 0; r < 4; ++r) {
-            if (board.at(r, c) != 0) {
-                if (writePos != r) {
-                    board.at(writePos, c) = board.at(r, c);
-                    board.at(r, c) = 0;
-                }
-                writePos++;
-            }
-        }
+void Puzzle2048Game::playMove(Board2048::Direction dir) {
+    if (engine.move(dir)) {
+        showMoveHint = false;
     }
-    
-    return moved;
 }
 
-bool Puzzle2048Game::moveDown() {
-    bool moved = false;
-    
-    for (size_t c = 0; c < 4; ++c) {
-        // Compress
-        int writePos = 3;
-        for (int r = 3; r >= 0; --r) {
-            if (board.at(r, c) != 0) {
-                if (writePos != r) {
-                    board.at(writePos, c) = board.at(r, c);
-                    board.at(r, c) = 0;
-                    moved = true;
-                }
-                writePos--;
-            }
-        }
-        
-        // Merge
-        for (int r = 3; r > 0; --r) {
-            if (board.at(r, c) != 0 && board.at(r, c) == board.at(r - 1, c)) {
-                board.at(r, c) *= 2;
-                score += board.at(r, c);
-                board.at(r - 1, c) = 0;
-                moved = true;
-                
-                if (board.at(r, c) == 2048) {
-                    won = true;
-                }
-            }
-        }
-        
-        // Compress again
-        writePos = 3;
-        for (int r = 3; r >= 0; --r) {
-            if (board.at(r, c) != 0) {
-                if (writePos != r) {
-                    board.at(writePos, c) = board.at(r, c);
-                    board.at(r, c) = 0;
-                }
-                writePos--;
-            }
-        }
+void Puzzle2048Game::ensureFontLoaded() {
+    if (fontLoaded) {
+        return;
     }
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
     
-    return moved;
-}
-
-bool Puzzle2048Game::canMove() const {
-    // Check for empty cells
-    for (size_t r = 0; r < 4; ++r) {
-        for (size_t c = 0; c < 4; ++c) {
-            if (board.at(r, c) == 0) return true;
-        }
-    }
-    
-    // Check for possible merges
-    for (size_t r = 0; r < 4; ++r) {
-        for (size_t c = 0; c < 3; ++c) {
-            if (board.at(r, c) == board.at(r, c + 1)) return true;
-        }
-    }
-    
-    for (size_t c = 0; c < 4; ++c) {
-        for (size_t r = 0; r < 3; ++r) {
-            if (board.at(r, c) == board.at(r + 1, c)) return true;
-        }
-    }
-    
-    return false;
+    // Enable smooth font rendering
+    const_cast<sf::Texture&>(font->getTexture(40)).setSmooth(true);
+    fontLoaded = true;
 }
 
 sf::Color Puzzle2048Game::getTileColor(int val) const {
@@ -282,160 +75,147 @@ sf::Color Puzzle2048Game::getTileColor(int val) const {
 }
 
 void Puzzle2048Game::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
-    if (gameOver) return;
+    if (engine.isFinished()) return;
     
     handleMouseDrag(event);
     
     if (event.type == sf::Event::KeyPressed) {
-        bool moved = false;
-        
         switch (event.key.code) {
             case sf::Keyboard::Left:
             case sf::Keyboard::A:
-                moved = moveLeft();
+                playMove(Board2048::Direction::Left);
                 break;
             case sf::Keyboard::Right:
             case sf::Keyboard::D:
-                moved = moveRight();
+                playMove(Board2048::Direction::Right);
                 break;
             case sf::Keyboard::Up:
             case sf::Keyboard::W:
-                moved = moveUp();
+                playMove(Board2048::Direction::Up);
                 break;
             case sf::Keyboard::Down:
             case sf::Keyboard::S:
-                moved = moveDown();
+                playMove(Board2048::Direction::Down);
+                break;
+            case sf::Keyboard::H:
+                showAIHint = !showAIHint;
+                refreshHint();
                 break;
             default:
                 break;
         }
-        
-        if (moved) {
-            spawnTile();
-            showMoveHint = false;
-            if (!canMove()) {
-                gameOver = true;
-                if (subject) {
-                    std::ostringstream oss;
-                    oss << "Score: " << score << (won ? " (Won!)" : " (Game Over)");
-                    subject->notifyGameOver(getName(), oss.str());
-                }
-            }
-        }
     }
 }
 
 void Puzzle2048Game::update(float dt) {
     animationTimer += dt;
-    if (gameOver) {
+    if (engine.isFinished()) {
         gameOverTimer += dt;
+        celebrationTimer += dt;
     }
 }
 
-void Puzzle2048Game::render(sf::RenderWindow& window) {
-    float cellSize = 120.0f;
-    float padding = 12.0f;
-    
-    // Draw gradient background
-    sf::RectangleShape bgGradient1(sf::Vector2f(900, 300));
-    bgGradient1.setPosition(0, 0);
-    bgGradient1.setFillColor(sf::Color(250, 248, 239));
-    window.draw(bgGradient1);
-    
-    sf::RectangleShape bgGradient2(sf::Vector2f(900, 300));
-    bgGradient2.setPosition(0, 300);
-    bgGradient2.setFillColor(sf::Color(237, 224, 200));
-    window.draw(bgGradient2);
-    
-    // Draw board background with shadow
-    sf::RectangleShape boardShadow(sf::Vector2f(540, 540));
-    boardShadow.setPosition(45, 85);
-    boardShadow.setFillColor(sf::Color(0, 0, 0, 40));
-    window.draw(boardShadow);
-    
-    sf::RectangleShape bg(sf::Vector2f(536, 536));
-    bg.setPosition(40, 80);
-    bg.setFillColor(sf::Color(187, 173, 160));
-    bg.setOutlineThickness(3);
-    bg.setOutlineColor(sf::Color(158, 143, 130));
-    window.draw(bg);
+namespace {
+constexpr float CellSize = 120.0f;
+constexpr float Padding = 12.0f;
+constexpr int GlowingTileExponent = 9;  // Tiles from 2^9 = 512 up pulse, so they are drawn every frame
+constexpr int GlowingTileValue = 1 << GlowingTileExponent;
+constexpr float MoveHintSeconds = 6.0f;
+
+sf::Vector2f tilePosition(size_t r, size_t c) {
+    return sf::Vector2f(40 + Padding + c * (CellSize + Padding), 80 + Padding + r * (CellSize + Padding));
+}
+}
+
+bool Puzzle2048Game::isAnimating() const {
+    return engine.isFinished() || (showMoveHint && animationTimer < MoveHintSeconds) ||
+           engine.getBitboard().getMaxExponent() >= GlowingTileExponent;
+}
+
+void Puzzle2048Game::rebuildBoardLayers() {
+    using Layer = BoardRenderer::Layer;
     
-    // Draw score with modern styling
-    sf::RectangleShape scoreBg(sf::Vector2f(200, 55));
-    scoreBg.setPosition(35, 15);
-    scoreBg.setFillColor(sf::Color(238, 228, 218));
-    scoreBg.setOutlineThickness(2);
-    scoreBg.setOutlineColor(sf::Color(187, 173, 160));
-    window.draw(scoreBg);
+    // Gradient background
+    boardRenderer.addRect(Layer::Background, 0, 0, 900, 300, sf::Color(250, 248, 239));
+    boardRenderer.addRect(Layer::Background, 0, 300, 900, 300, sf::Color(237, 224, 200));
     
-    sf::Text scoreLabel;
-    scoreLabel.setFont(font);
-    scoreLabel.setString("SCORE");
-    scoreLabel.setCharacterSize(18);
-    scoreLabel.setFillColor(sf::Color(119, 110, 101));
-    scoreLabel.setStyle(sf::Text::Bold);
-    scoreLabel.setPosition(45, 20);
-    window.draw(scoreLabel);
+    // Board background with shadow
+    boardRenderer.addRect(Layer::Shadows, 45, 85, 540, 540, sf::Color(0, 0, 0, 40));
+    boardRenderer.addOutlinedRect(Layer::Cells, 40, 80, 536, 536, sf::Color(187, 173, 160),
+                                  3, sf::Color(158, 143, 130));
     
-    sf::Text scoreText;
-    scoreText.setFont(font);
-    scoreText.setString(std::to_string(score));
-    scoreText.setCharacterSize(26);
-    scoreText.setFillColor(sf::Color(119, 110, 101));
-    scoreText.setStyle(sf::Text::Bold);
-    scoreText.setPosition(45, 42);
-    window.draw(scoreText);
+    // Score with modern styling
+    boardRenderer.addOutlinedRect(Layer::Cells, 35, 15, 200, 55, sf::Color(238, 228, 218),
+                                  2, sf::Color(187, 173, 160));
+    boardRenderer.addText(*font, "SCORE", 18, true, sf::Vector2f(45, 20), sf::Color(119, 110, 101));
+    boardRenderer.addText(*font, std::to_string(engine.getScore()), 26, true, sf::Vector2f(45, 42), sf::Color(119, 110, 101));
     
-    // Draw tiles with enhanced effects
+    // Tile shadows, then tiles and their numbers
     for (size_t r = 0; r < 4; ++r) {
         for (size_t c = 0; c < 4; ++c) {
-            float x = 40 + padding + c * (cellSize + padding);
-            float y = 80 + padding + r * (cellSize + padding);
-            
-            // Tile shadow
-            sf::RectangleShape tileShadow(sf::Vector2f(cellSize, cellSize));
-            tileShadow.setPosition(x + 3, y + 3);
-            tileShadow.setFillColor(sf::Color(0, 0, 0, 30));
-            window.draw(tileShadow);
-            
-            sf::RectangleShape tile(sf::Vector2f(cellSize, cellSize));
-            tile.setPosition(x, y);
-            
-            sf::Color tileColor = getTileColor(board.at(r, c));
-            
-            // Add glow effect for high value tiles
-            if (board.at(r, c) >= 512) {
-                float glow = 0.85f + 0.15f * std::sin(animationTimer * 3.0f);
-                tileColor.r = std::min(255, (int)(tileColor.r * glow));
-                tileColor.g = std::min(255, (int)(tileColor.g * glow));
-                tileColor.b = std::min(255, (int)(tileColor.b * glow));
+            const sf::Vector2f pos = tilePosition(r, c);
+            boardRenderer.addRect(Layer::Cells, pos.x + 3, pos.y + 3, CellSize, CellSize, sf::Color(0, 0, 0, 30));
+        }
+    }
+    for (size_t r = 0; r < 4; ++r) {
+        for (size_t c = 0; c < 4; ++c) {
+            const int value = board(r, c);
+            const sf::Vector2f pos = tilePosition(r, c);
+            if (value < GlowingTileValue) {
+                boardRenderer.addRect(Layer::Cells, pos.x, pos.y, CellSize, CellSize, getTileColor(value));
             }
             
-            tile.setFillColor(tileColor);
-            window.draw(tile);
-            
-            if (board.at(r, c) != 0) {
-                sf::Text text;
-                text.setFont(font);
-                text.setString(std::to_string(board.at(r, c)));
+            if (value != 0) {
+                const std::string label = std::to_string(value);
                 
                 // Adjust font size based on number length
-                if (board.at(r, c) < 100) text.setCharacterSize(50);
-                else if (board.at(r, c) < 1000) text.setCharacterSize(45);
-                else text.setCharacterSize(38);
+                unsigned characterSize = 38;
+                if (value < 100) characterSize = 50;
+                else if (value < 1000) characterSize = 45;
                 
-                text.setFillColor(board.at(r, c) <= 4 ? sf::Color(119, 110, 101) : sf::Color::White);
-                text.setStyle(sf::Text::Bold);
-                
-                sf::FloatRect bounds = text.getLocalBounds();
-                text.setPosition(
-                    x + (cellSize - bounds.width) / 2 - bounds.left,
-                    y + (cellSize - bounds.height) / 2 - bounds.top - 3
-                );
-                window.draw(text);
+                const sf::FloatRect bounds = BoardRenderer::measureText(*font, label, characterSize, true);
+                boardRenderer.addText(*font, label, characterSize, true,
+                                      sf::Vector2f(pos.x + (CellSize - bounds.width) / 2 - bounds.left,
+                                                   pos.y + (CellSize - bounds.height) / 2 - bounds.top - 3),
+                                      value <= 4 ? sf::Color(119, 110, 101) : sf::Color::White);
             }
         }
     }
+}
+
+void Puzzle2048Game::render(sf::RenderWindow& window, float interpolation) {
+    ensureFontLoaded();
+    
+    // Animation timers advance in fixed steps; draw them where they are between steps
+    const float frameOffset = interpolation * UpdateStep;
+    const float animationTime = animationTimer + frameOffset;
+    const float gameOverTime = gameOverTimer + frameOffset;
+    const float celebrationTime = celebrationTimer + frameOffset;
+    
+    // Tiles and score only change on a move, so the board is rebuilt only then
+    if (syncedVersion != engine.getVersion()) {
+        syncBoardView();
+    }
+    if (boardRenderer.needsRebuild(syncedVersion)) {
+        boardRenderer.rebuild(syncedVersion);
+        rebuildBoardLayers();
+    }
+    
+    // High value tiles glow, so they are refreshed every frame
+    boardRenderer.clearLayer(BoardRenderer::Layer::Animated);
+    const float glow = 0.85f + 0.15f * std::sin(animationTime * 3.0f);
+    for (size_t r = 0; r < 4; ++r) {
+        for (size_t c = 0; c < 4; ++c) {
+            if (board(r, c) < GlowingTileValue) continue;
+            sf::Color tileColor = getTileColor(board(r, c));
+            tileColor.r = std::min(255, (int)(tileColor.r * glow));
+            tileColor.g = std::min(255, (int)(tileColor.g * glow));
+            tileColor.b = std::min(255, (int)(tileColor.b * glow));
+            const sf::Vector2f pos = tilePosition(r, c);
+            boardRenderer.addRect(BoardRenderer::Layer::Animated, pos.x, pos.y, CellSize, CellSize, tileColor);
+        }
+    }
+    boardRenderer.draw(window);
 
     // Instructions panel with modern design
     sf::RectangleShape instructionBg(sf::Vector2f(280, 380));
@@ -445,22 +225,12 @@ void Puzzle2048Game::render(sf::RenderWindow& window) {
     instructionBg.setOutlineColor(sf::Color(187, 173, 160));
     window.draw(instructionBg);
     
-    sf::Text title;
-    title.setFont(font);
-    title.setString("2048");
-    title.setCharacterSize(48);
+    sf::Text& title = texts.get("2048", 48, sf::Text::Bold);
     title.setFillColor(sf::Color(119, 110, 101));
-    title.setStyle(sf::Text::Bold);
     title.setPosition(660.f, 90.f);
     window.draw(title);
     
-    sf::Text instructions;
-    instructions.setFont(font);
-    instructions.setCharacterSize(16);
-    instructions.setFillColor(sf::Color(119, 110, 101));
-    instructions.setPosition(605.f, 160.f);
-    instructions.setString(
-        "HOW TO PLAY\n\n"
+    sf::Text& instructions = texts.get("HOW TO PLAY\n\n"
         "\x95 Arrow Keys / WASD\n"
         "\x95 Swipe with Mouse\n\n"
         "Tiles slide in the\n"
@@ -469,31 +239,55 @@ void Puzzle2048Game::render(sf::RenderWindow& window) {
         "the same number touch,\n"
         "they merge into one!\n\n"
         "Reach 2048 to WIN!\n\n"
-        "ESC - Exit Game"
-    );
+        "H - AI Hint | ESC - Exit", 16);
+    instructions.setFillColor(sf::Color(119, 110, 101));
+    instructions.setPosition(605.f, 160.f);
     window.draw(instructions);
     
+    // AI hint panel below the instructions
+    const bool gameOver = engine.isFinished();
+    const bool won = engine.isWon();
+    if (showAIHint && !gameOver) {
+        sf::RectangleShape hintPanel(sf::Vector2f(280, 50));
+        hintPanel.setPosition(590.f, 475.f);
+        hintPanel.setFillColor(sf::Color(143, 122, 102, 230));
+        hintPanel.setOutlineThickness(3);
+        hintPanel.setOutlineColor(sf::Color(187, 173, 160));
+        window.draw(hintPanel);
+        
+        const char* hintLabel = "AI Hint: No moves";
+        if (aiHint) {
+            switch (*aiHint) {
+                case Board2048::Direction::Left: hintLabel = "AI Hint: LEFT"; break;
+                case Board2048::Direction::Right: hintLabel = "AI Hint: RIGHT"; break;
+                case Board2048::Direction::Up: hintLabel = "AI Hint: UP"; break;
+                case Board2048::Direction::Down: hintLabel = "AI Hint: DOWN"; break;
+            }
+        }
+        
+        sf::Text& hintMoveText = texts.get(hintLabel, 22, sf::Text::Bold);
+        hintMoveText.setFillColor(sf::Color::White);
+        hintMoveText.setPosition(605.f, 486.f);
+        window.draw(hintMoveText);
+    }
+    
     // Show drag hint for first few seconds with pulse effect
-    if (showMoveHint && animationTimer < 6.0f) {
-        float alpha = 180 + 75 * std::sin(animationTimer * 3.0f);
+    if (showMoveHint && animationTime < MoveHintSeconds) {
+        float alpha = 180 + 75 * std::sin(animationTime * 3.0f);
         sf::RectangleShape hintBg(sf::Vector2f(300, 40));
         hintBg.setPosition(140.f, 515.f);
         hintBg.setFillColor(sf::Color(255, 200, 0, alpha * 0.6f));
         window.draw(hintBg);
         
-        sf::Text hintText;
-        hintText.setFont(font);
-        hintText.setString("Try swiping on the board!");
-        hintText.setCharacterSize(18);
+        sf::Text& hintText = texts.get("Try swiping on the board!", 18, sf::Text::Bold);
         hintText.setFillColor(sf::Color(80, 60, 0, alpha));
-        hintText.setStyle(sf::Text::Bold);
         hintText.setPosition(150.f, 522.f);
         window.draw(hintText);
     }
     
     if (gameOver) {
         // Overlay with fade-in
-        float overlayAlpha = std::min(180.0f, gameOverTimer * 250.0f);
+        float overlayAlpha = std::min(180.0f, gameOverTime * 250.0f);
         sf::RectangleShape overlay(sf::Vector2f(536, 536));
         overlay.setPosition(40, 80);
         overlay.setFillColor(sf::Color(238, 228, 218, overlayAlpha));
@@ -506,45 +300,33 @@ void Puzzle2048Game::render(sf::RenderWindow& window) {
         window.draw(msgBg);
         
         // Animated text with glow
-        sf::Text glowText;
-        glowText.setFont(font);
-        glowText.setString(won ? "YOU WON!" : "GAME OVER!");
-        glowText.setCharacterSize(won ? 52 : 48);
-        float pulse = 0.7f + 0.3f * std::sin(gameOverTimer * 4.0f);
+        float pulse = 0.7f + 0.3f * std::sin(gameOverTime * 4.0f);
+        sf::Text& glowText = texts.get(won ? "YOU WON!" : "GAME OVER!", won ? 52 : 48, sf::Text::Bold);
         glowText.setFillColor(sf::Color(255, 255, 255, 150 * pulse));
-        glowText.setStyle(sf::Text::Bold);
         glowText.setPosition(won ? 162 : 142, 268);
         window.draw(glowText);
         
-        sf::Text text;
-        text.setFont(font);
-        text.setString(won ? "YOU WON!" : "GAME OVER!");
-        text.setCharacterSize(won ? 52 : 48);
+        sf::Text& text = texts.get(won ? "YOU WON!" : "GAME OVER!", won ? 52 : 48, sf::Text::Bold);
         text.setFillColor(sf::Color::White);
-        text.setStyle(sf::Text::Bold);
         text.setPosition(won ? 160 : 140, 270);
         window.draw(text);
         
-        sf::Text subText;
-        subText.setFont(font);
-        subText.setString(won ? "View leaderboard or scoreboard" : "Press ESC to exit");
-        subText.setCharacterSize(20);
+        sf::Text& subText = texts.get(won ? "View leaderboard or scoreboard" : "Press ESC to exit", 20);
         subText.setFillColor(sf::Color(255, 255, 255, 230));
         subText.setPosition(won ? 108 : 160, 325);
         window.draw(subText);
         
         // Celebration particles for win
         if (won) {
-            celebrationTimer += 0.016f;
             for (int i = 0; i < 20; ++i) {
-                float angle = (i / 20.0f) * 6.28318f + celebrationTimer;
-                float radius = 150 + 30 * std::sin(celebrationTimer * 2 + i);
+                float angle = (i / 20.0f) * 6.28318f + celebrationTime;
+                float radius = 150 + 30 * std::sin(celebrationTime * 2 + i);
                 float x = 308 + radius * std::cos(angle);
                 float y = 328 + radius * std::sin(angle);
                 
                 sf::CircleShape particle(4);
                 particle.setPosition(x, y);
-                float hue = (i / 20.0f + celebrationTimer * 0.2f);
+                float hue = (i / 20.0f + celebrationTime * 0.2f);
                 particle.setFillColor(sf::Color(255, 215, 0, 200));
                 window.draw(particle);
             }
@@ -573,37 +355,23 @@ void Puzzle2048Game::processDragDirection() {
         return; // Not enough movement
     }
     
-    bool moved = false;
     if (std::abs(delta.x) > std::abs(delta.y)) {
         // Horizontal drag
         if (delta.x > 0) {
-            moved = moveRight();
+            playMove(Board2048::Direction::Right);
         } else {
-            moved = moveLeft();
+            playMove(Board2048::Direction::Left);
         }
     } else {
         // Vertical drag
         if (delta.y > 0) {
-            moved = moveDown();
+            playMove(Board2048::Direction::Down);
         } else {
-            moved = moveUp();
-        }
-    }
-    
-    if (moved) {
-        spawnTile();
-        showMoveHint = false;
-        if (!canMove()) {
-            gameOver = true;
-            if (subject) {
-                std::ostringstream oss;
-                oss << "Score: " << score << (won ? " (Won!)" : " (Game Over)");
-                subject->notifyGameOver(getName(), oss.str());
-            }
+            playMove(Board2048::Direction::Up);
         }
     }
 }
 
 bool Puzzle2048Game::isOver() const {
-    return gameOver && gameOverTimer >= 45.0f;
+    return engine.isFinished() && gameOverTimer >= 45.0f;
 }
@@ -0,0 +1,43 @@
+#include "../include/games/SudokuConstraints.hpp"
+
+void SudokuConstraints::clear() {
+    usedMasks.fill(0);
+    duplicateMasks.fill(0);
+    for (auto& unitCounts : counts) {
+        unitCounts.fill(0);
+    }
+    filledCells = 0;
+    duplicateCount = 0;
+}
+
+void SudokuConstraints::adjust(int unit, int digitIndex, int delta) {
+    const std::uint16_t bit = static_cast<std::uint16_t>(1u << digitIndex);
+    std::uint8_t& count = counts[unit][digitIndex];
+    const int before = count;
+    count = static_cast<std::uint8_t>(before + delta);
+
+    if (count > 0) usedMasks[unit] |= bit;
+    else usedMasks[unit] &= static_cast<std::uint16_t>(~bit);
+
+    if (count > 1) duplicateMasks[unit] |= bit;
+    else duplicateMasks[unit] &= static_cast<std::uint16_t>(~bit);
+
+    if (before < 2 && count >= 2) ++duplicateCount;
+    else if (before >= 2 && count < 2) --duplicateCount;
+}
+
+void SudokuConstraints::place(int r, int c, int val) {
+    const int digitIndex = val - 1;
+    adjust(r, digitIndex, 1);
+    adjust(9 + c, digitIndex, 1);
+    adjust(18 + boxIndex(r, c), digitIndex, 1);
+    ++filledCells;
+}
+
+void SudokuConstraints::erase(int r, int c, int val) {
+    const int digitIndex = val - 1;
+    adjust(r, digitIndex, -1);
+    adjust(9 + c, digitIndex, -1);
+    adjust(18 + boxIndex(r, c), digitIndex, -1);
+    --filledCells;
+}
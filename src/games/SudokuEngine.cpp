@@ -0,0 +1,181 @@
+#include "../include/games/SudokuEngine.hpp"
+#include "../include/util/SudokuPuzzleBank.hpp"
+#include <random>
+
+namespace {
+/**
+ * Pre-generated puzzles, mapped once and shared by every Sudoku instance
+ * (build with SudokuBankGenerator)
+ */
+const SudokuPuzzleBank& puzzleBank() {
+    static const SudokuPuzzleBank bank("assets/sudoku_bank.bin");
+    return bank;
+}
+}
+
+SudokuEngine::SudokuEngine(Subject* subj)
+    : board(0), fixedCells(false), subject(subj) {}
+
+std::string SudokuEngine::getName() const {
+    return "Sudoku";
+}
+
+void SudokuEngine::init() {
+    beginSession();
+    gameOver = false;
+    loadPuzzle();
+}
+
+void SudokuEngine::initFixed(const SudokuSolver::Puzzle& puzzle) {
+    beginSession();
+    gameOver = false;
+    setGivens(puzzle);
+}
+
+void SudokuEngine::setGivens(const SudokuSolver::Puzzle& puzzle) {
+    board.reset(0);
+    fixedCells.reset(false);
+    constraints.clear();
+    touch();
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            const int val = puzzle[r * 9 + c];
+            setCell(r, c, val);
+            fixedCells(r, c) = (val != 0);
+        }
+    }
+}
+
+void SudokuEngine::loadPuzzle() {
+    const SudokuPuzzleBank& bank = puzzleBank();
+    const size_t available = bank.count(difficulty);
+    if (available > 0) {
+        std::uniform_int_distribution<size_t> pick(0, available - 1);
+        if (const auto puzzle = bank.get(difficulty, pick(rng))) {
+            setGivens(*puzzle);
+            return;
+        }
+    }
+
+    // Fallback puzzle when no bank is installed or the drawn record is corrupt
+    static constexpr SudokuSolver::Puzzle fallback = {
+        5, 3, 0, 0, 7, 0, 0, 0, 0,
+        6, 0, 0, 1, 9, 5, 0, 0, 0,
+        0, 9, 8, 0, 0, 0, 0, 6, 0,
+        8, 0, 0, 0, 6, 0, 0, 0, 3,
+        4, 0, 0, 8, 0, 3, 0, 0, 1,
+        7, 0, 0, 0, 2, 0, 0, 0, 6,
+        0, 6, 0, 0, 0, 0, 2, 8, 0,
+        0, 0, 0, 4, 1, 9, 0, 0, 5,
+        0, 0, 0, 0, 8, 0, 0, 7, 9
+    };
+    setGivens(fallback);
+}
+
+void SudokuEngine::setCell(int r, int c, int val) {
+    touch();
+    int& cell = board(r, c);
+    if (cell != 0) {
+        constraints.erase(r, c, cell);
+    }
+    cell = val;
+    if (val != 0) {
+        constraints.place(r, c, val);
+    }
+}
+
+bool SudokuEngine::isValidMove(int r, int c, int val) const {
+    // The cell's own digit does not count against it
+    if (board(r, c) == val) {
+        return !constraints.isConflict(r, c, val);
+    }
+    return (constraints.getUsedMask(r, c) & (1u << (val - 1))) == 0;
+}
+
+bool SudokuEngine::isSolved() const {
+    return constraints.isSolved();
+}
+
+bool SudokuEngine::isConflict(int r, int c) const {
+    const int val = board(r, c);
+    return val != 0 && constraints.isConflict(r, c, val);
+}
+
+bool SudokuEngine::placeNumber(int r, int c, int val) {
+    if (gameOver || fixedCells.at(r, c) || !isValidMove(r, c, val)) {
+        return false;
+    }
+
+    setCell(r, c, val);
+    recordAction(r * 81 + c * 9 + (val - 1));
+    if (subject) {
+        subject->notifyCellFilled(getName(), r, c, val);
+    }
+    if (isSolved()) {
+        gameOver = true;
+        if (subject) {
+            subject->notifyGameOver(getName(), "Solved!");
+        }
+    }
+    return true;
+}
+
+bool SudokuEngine::clearCell(int r, int c) {
+    if (gameOver || fixedCells.at(r, c)) {
+        return false;
+    }
+    setCell(r, c, 0);
+    recordAction(ClearActionBase + r * 9 + c);
+    if (subject) {
+        subject->notifyCellFilled(getName(), r, c, 0);
+    }
+    return true;
+}
+
+std::vector<int> SudokuEngine::getLegalActions() const {
+    std::vector<int> actions;
+    if (gameOver) {
+        return actions;
+    }
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            // Fixed cells always hold a clue, so an empty cell is editable
+            if (board(r, c) != 0) continue;
+            const std::uint16_t candidates = constraints.getCandidates(r, c);
+            for (int val = 1; val <= 9; ++val) {
+                if (candidates & (1u << (val - 1))) {
+                    actions.push_back(r * 81 + c * 9 + (val - 1));
+                }
+            }
+        }
+    }
+    return actions;
+}
+
+bool SudokuEngine::applyAction(int action) {
+    if (gameOver || action < 0 || action >= ClearActionBase + 81) {
+        return false;
+    }
+    if (action >= ClearActionBase) {
+        return clearCell((action - ClearActionBase) / 9, (action - ClearActionBase) % 9);
+    }
+    int r = action / 81;
+    int c = (action / 9) % 9;
+    int val = action % 9 + 1;
+    // Same rules as the UI: a filled cell that is not a clue may be overwritten
+    return placeNumber(r, c, val);
+}
+
+bool SudokuEngine::isFinished() const {
+    return gameOver;
+}
+
+std::uint32_t SudokuEngine::getSettings() const {
+    return static_cast<std::uint32_t>(difficulty);
+}
+
+void SudokuEngine::applySettings(std::uint32_t settings) {
+    if (settings < static_cast<std::uint32_t>(SudokuSolver::DifficultyCount)) {
+        difficulty = static_cast<SudokuSolver::Difficulty>(settings);
+    }
+}
@@ -1,91 +1,32 @@
 #include "../include/games/SudokuGame.hpp"
-#include <random>
 #include <cmath>
+#include <cstdio>
 
-SudokuGame::SudokuGame(Subject* subj)
-    : board(9, 9, 0), fixedCells(9, 9, false), gameOver(false), 
-      subject(subj), selectedRow(-1), selectedCol(-1) {}
+SudokuGame::SudokuGame(Subject* subj) : engine(subj) {}
 
 std::string SudokuGame::getName() const {
-    return "Sudoku";
+    return engine.getName();
 }
 
 void SudokuGame::init() {
-    board.reset(0);
-    fixedCells.reset(false);
-    gameOver = false;
+    engine.init();
     gameOverTimer = 0.f;
     celebrationTimer = 0.f;
     selectedRow = -1;
     selectedCol = -1;
-    
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
-    
-    // Enable smooth font rendering
-    const_cast<sf::Texture&>(font.getTexture(30)).setSmooth(true);
-    
-    loadPuzzle();
-}
-
-void SudokuGame::loadPuzzle() {
-    // Simple puzzle for demonstration
-    int puzzle[9][9] = {
-        {5, 3, 0, 0, 7, 0, 0, 0, 0},
-        {6, 0, 0, 1, 9, 5, 0, 0, 0},
-        {0, 9, 8, 0, 0, 0, 0, 6, 0},
-        {8, 0, 0, 0, 6, 0, 0, 0, 3},
-        {4, 0, 0, 8, 0, 3, 0, 0, 1},
-        {7, 0, 0, 0, 2, 0, 0, 0, 6},
-        {0, 6, 0, 0, 0, 0, 2, 8, 0},
-        {0, 0, 0, 4, 1, 9, 0, 0, 5},
-        {0, 0, 0, 0, 8, 0, 0, 7, 9}
-    };
-    
-    for (int r = 0; r < 9; ++r) {
-        for (int c = 0; c < 9; ++c) {
-            board.at(r, c) = puzzle[r][c];
-            fixedCells.at(r, c) = (puzzle[r][c] != 0);
-        }
-    }
+    ++renderVersion;
 }
 
-bool SudokuGame::isValidMove(int r, int c, int val) const {
-    // Check row
-    for (int i = 0; i < 9; ++i) {
-        if (i != c && board.at(r, i) == val) return false;
-    }
-    
-    // Check column
-    for (int i = 0; i < 9; ++i) {
-        if (i != r && board.at(i, c) == val) return false;
-    }
-    
-    // Check 3x3 box
-    int boxR = (r / 3) * 3;
-    int boxC = (c / 3) * 3;
-    for (int i = 0; i < 3; ++i) {
-        for (int j = 0; j < 3; ++j) {
-            int row = boxR + i;
-            int col = boxC + j;
-            if ((row != r || col != c) && board.at(row, col) == val) {
-                return false;
-            }
-        }
+void SudokuGame::ensureFontLoaded() {
+    if (fontLoaded) {
+        return;
     }
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
     
-    return true;
-}
-
-bool SudokuGame::isSolved() const {
-    for (size_t r = 0; r < 9; ++r) {
-        for (size_t c = 0; c < 9; ++c) {
-            if (board.at(r, c) == 0) return false;
-            if (!isValidMove(r, c, board.at(r, c))) return false;
-        }
-    }
-    return true;
+    // Enable smooth font rendering
+    const_cast<sf::Texture&>(font->getTexture(30)).setSmooth(true);
+    fontLoaded = true;
 }
 
 void SudokuGame::handleClick(sf::Vector2i pos, sf::RenderWindow& window) {
@@ -94,15 +35,16 @@ void SudokuGame::handleClick(sf::Vector2i pos, sf::RenderWindow& window) {
     int col = pos.x / cellSize;
     
     if (row >= 0 && row < 9 && col >= 0 && col < 9) {
-        if (!fixedCells.at(row, col)) {
+        if (!engine.isFixed(row, col)) {
             selectedRow = row;
             selectedCol = col;
+            ++renderVersion;
         }
     }
 }
 
 void SudokuGame::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
-    if (gameOver) return;
+    if (engine.isFinished()) return;
     
     if (event.type == sf::Event::MouseButtonPressed) {
         if (event.mouseButton.button == sf::Mouse::Left) {
@@ -111,21 +53,20 @@ void SudokuGame::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
     } else if (event.type == sf::Event::MouseMoved) {
         updateHover(sf::Mouse::getPosition(window));
     } else if (event.type == sf::Event::KeyPressed) {
-        if (selectedRow >= 0 && selectedCol >= 0) {
+        if (event.key.code == sf::Keyboard::N) {
+            init();
+        } else if (event.key.code == sf::Keyboard::D) {
+            // Cycle Easy -> Medium -> Hard -> Expert and deal a new puzzle
+            engine.setDifficulty(static_cast<SudokuSolver::Difficulty>(
+                (static_cast<int>(engine.getDifficulty()) + 1) % SudokuSolver::DifficultyCount));
+            init();
+        } else if (selectedRow >= 0 && selectedCol >= 0) {
             if (event.key.code >= sf::Keyboard::Num1 && event.key.code <= sf::Keyboard::Num9) {
                 int num = event.key.code - sf::Keyboard::Num0;
-                if (isValidMove(selectedRow, selectedCol, num)) {
-                    board.at(selectedRow, selectedCol) = num;
-                    if (isSolved()) {
-                        gameOver = true;
-                        if (subject) {
-                            subject->notifyGameOver(getName(), "Solved!");
-                        }
-                    }
-                }
+                engine.placeNumber(selectedRow, selectedCol, num);
             } else if (event.key.code == sf::Keyboard::Delete || 
                        event.key.code == sf::Keyboard::BackSpace) {
-                board.at(selectedRow, selectedCol) = 0;
+                engine.clearCell(selectedRow, selectedCol);
             }
         }
     }
@@ -133,129 +74,116 @@ void SudokuGame::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
 
 void SudokuGame::update(float dt) {
     highlightTimer += dt;
-    if (gameOver) {
+    if (engine.isFinished()) {
         gameOverTimer += dt;
+        celebrationTimer += dt;
     }
 }
 
-void SudokuGame::render(sf::RenderWindow& window) {
-    float cellSize = 60.0f;
-    
-    // Draw gradient background
-    sf::RectangleShape bgTop(sf::Vector2f(900, 270));
-    bgTop.setPosition(0, 0);
-    bgTop.setFillColor(sf::Color(245, 245, 250));
-    window.draw(bgTop);
-    
-    sf::RectangleShape bgBottom(sf::Vector2f(900, 330));
-    bgBottom.setPosition(0, 270);
-    bgBottom.setFillColor(sf::Color(235, 235, 245));
-    window.draw(bgBottom);
+bool SudokuGame::isAnimating() const {
+    if (engine.isFinished() || (selectedRow >= 0 && selectedCol >= 0)) {
+        return true;
+    }
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            if (engine.isConflict(r, c)) return true;
+        }
+    }
+    return false;
+}
+
+void SudokuGame::rebuildBoardLayers() {
+    using Layer = BoardRenderer::Layer;
+    const Grid<int, 9, 9>& board = engine.getBoard();
+    const float cellSize = 60.0f;
     
-    // Draw board shadow
-    sf::RectangleShape boardShadow(sf::Vector2f(545, 545));
-    boardShadow.setPosition(3, 3);
-    boardShadow.setFillColor(sf::Color(0, 0, 0, 30));
-    window.draw(boardShadow);
+    // Gradient background and board shadow
+    boardRenderer.addRect(Layer::Background, 0, 0, 900, 270, sf::Color(245, 245, 250));
+    boardRenderer.addRect(Layer::Background, 0, 270, 900, 330, sf::Color(235, 235, 245));
+    boardRenderer.addRect(Layer::Shadows, 3, 3, 545, 545, sf::Color(0, 0, 0, 30));
     
-    // Draw cells with enhanced effects
     for (int r = 0; r < 9; ++r) {
         for (int c = 0; c < 9; ++c) {
-            sf::RectangleShape cell(sf::Vector2f(cellSize - 2, cellSize - 2));
-            cell.setPosition(c * cellSize + 1, r * cellSize + 1);
-            
-            // Check for conflicts
-            bool hasConflict = false;
-            if (board.at(r, c) != 0 && !fixedCells.at(r, c)) {
-                for (int i = 0; i < 9; ++i) {
-                    if ((i != c && board.at(r, i) == board.at(r, c)) ||
-                        (i != r && board.at(i, c) == board.at(r, c))) {
-                        hasConflict = true;
-                        break;
-                    }
-                }
-                // Check 3x3 box
-                if (!hasConflict) {
-                    int boxR = (r / 3) * 3;
-                    int boxC = (c / 3) * 3;
-                    for (int i = 0; i < 3 && !hasConflict; ++i) {
-                        for (int j = 0; j < 3; ++j) {
-                            int row = boxR + i;
-                            int col = boxC + j;
-                            if ((row != r || col != c) && board.at(row, col) == board.at(r, c)) {
-                                hasConflict = true;
-                                break;
-                            }
-                        }
-                    }
-                }
-            }
+            const int val = board(r, c);
+            const bool fixed = engine.isFixed(r, c);
+            const bool hasConflict = !fixed && engine.isConflict(r, c);
             
-            if (hasConflict) {
-                float pulse = 0.6f + 0.4f * std::sin(highlightTimer * 4.0f);
-                cell.setFillColor(sf::Color(255, 100, 100, 200 * pulse));
-            } else if (r == selectedRow && c == selectedCol) {
-                float pulse = 0.85f + 0.15f * std::sin(highlightTimer * 3.0f);
-                cell.setFillColor(sf::Color(100, 150, 255, 220 * pulse));
-            } else if (r == hoverRow && c == hoverCol && !fixedCells.at(r, c)) {
-                cell.setFillColor(sf::Color(180, 220, 255, 180));
+            sf::Color fill = sf::Color::Transparent;
+            if (hasConflict || (r == selectedRow && c == selectedCol)) {
+                // Pulsing cells are filled every frame in render()
+            } else if (r == hoverRow && c == hoverCol && !fixed) {
+                fill = sf::Color(180, 220, 255, 180);
             } else if (selectedRow >= 0 && (r == selectedRow || c == selectedCol)) {
-                cell.setFillColor(sf::Color(220, 230, 255, 150));
-            } else if (selectedRow >= 0 && board.at(r, c) != 0 && board.at(r, c) == board.at(selectedRow, selectedCol)) {
-                cell.setFillColor(sf::Color(200, 220, 255, 180));
-            } else if (fixedCells.at(r, c)) {
-                cell.setFillColor(sf::Color(235, 235, 245));
+                fill = sf::Color(220, 230, 255, 150);
+            } else if (selectedRow >= 0 && val != 0 && val == board(selectedRow, selectedCol)) {
+                fill = sf::Color(200, 220, 255, 180);
+            } else if (fixed) {
+                fill = sf::Color(235, 235, 245);
             } else {
-                cell.setFillColor(sf::Color(255, 255, 255));
+                fill = sf::Color(255, 255, 255);
             }
+            boardRenderer.addOutlinedRect(Layer::Cells, c * cellSize + 1, r * cellSize + 1,
+                                          cellSize - 2, cellSize - 2, fill, 1, sf::Color(200, 200, 210));
             
-            cell.setOutlineThickness(1);
-            cell.setOutlineColor(sf::Color(200, 200, 210));
-            window.draw(cell);
-            
-            // Draw number with shadow
-            if (board.at(r, c) != 0) {
-                // Shadow
-                sf::Text shadow;
-                shadow.setFont(font);
-                shadow.setString(std::to_string(board.at(r, c)));
-                shadow.setCharacterSize(32);
-                shadow.setFillColor(sf::Color(0, 0, 0, 30));
-                shadow.setPosition(c * cellSize + 19, r * cellSize + 9);
-                window.draw(shadow);
-                
-                // Main number
-                sf::Text text;
-                text.setFont(font);
-                text.setString(std::to_string(board.at(r, c)));
-                text.setCharacterSize(32);
-                text.setStyle(sf::Text::Bold);
+            // Number with shadow
+            if (val != 0) {
+                const std::string label(1, static_cast<char>('0' + val));
+                boardRenderer.addText(*font, label, 32, false,
+                                      sf::Vector2f(c * cellSize + 19, r * cellSize + 9), sf::Color(0, 0, 0, 30));
                 
+                sf::Color textColor(0, 100, 200);
                 if (hasConflict) {
-                    text.setFillColor(sf::Color(200, 0, 0));
-                } else if (fixedCells.at(r, c)) {
-                    text.setFillColor(sf::Color(40, 40, 50));
-                } else {
-                    text.setFillColor(sf::Color(0, 100, 200));
+                    textColor = sf::Color(200, 0, 0);
+                } else if (fixed) {
+                    textColor = sf::Color(40, 40, 50);
                 }
-                
-                text.setPosition(c * cellSize + 18, r * cellSize + 8);
-                window.draw(text);
+                boardRenderer.addText(*font, label, 32, true,
+                                      sf::Vector2f(c * cellSize + 18, r * cellSize + 8), textColor);
             }
         }
     }
     
-    // Draw thick grid lines for 3x3 boxes
+    // Thick grid lines for 3x3 boxes
     for (int i = 0; i <= 9; i += 3) {
-        sf::RectangleShape line(sf::Vector2f(540, i == 0 || i == 9 ? 4 : 4));
-        line.setPosition(0, i * cellSize - 2);
-        line.setFillColor(sf::Color(70, 70, 90));
-        window.draw(line);
-        
-        line.setSize(sf::Vector2f(i == 0 || i == 9 ? 4 : 4, 540));
-        line.setPosition(i * cellSize - 2, 0);
-        window.draw(line);
+        boardRenderer.addRect(Layer::Overlay, 0, i * cellSize - 2, 540, 4, sf::Color(70, 70, 90));
+        boardRenderer.addRect(Layer::Overlay, i * cellSize - 2, 0, 4, 540, sf::Color(70, 70, 90));
+    }
+}
+
+void SudokuGame::render(sf::RenderWindow& window, float interpolation) {
+    ensureFontLoaded();
+    
+    // Animation timers advance in fixed steps; draw them where they are between steps
+    const float frameOffset = interpolation * UpdateStep;
+    const float highlightTime = highlightTimer + frameOffset;
+    const float gameOverTime = gameOverTimer + frameOffset;
+    const float celebrationTime = celebrationTimer + frameOffset;
+    
+    float cellSize = 60.0f;
+    
+    // Both counters only grow, so their sum changes whenever either does
+    const std::uint64_t renderKey = renderVersion + engine.getVersion();
+    if (boardRenderer.needsRebuild(renderKey)) {
+        boardRenderer.rebuild(renderKey);
+        rebuildBoardLayers();
+    }
+    
+    // Pulsing highlights for conflicts and the selected cell
+    boardRenderer.clearLayer(BoardRenderer::Layer::Animated);
+    for (int r = 0; r < 9; ++r) {
+        for (int c = 0; c < 9; ++c) {
+            if (!engine.isFixed(r, c) && engine.isConflict(r, c)) {
+                float pulse = 0.6f + 0.4f * std::sin(highlightTime * 4.0f);
+                boardRenderer.addRect(BoardRenderer::Layer::Animated, c * cellSize + 1, r * cellSize + 1,
+                                      cellSize - 2, cellSize - 2, sf::Color(255, 100, 100, 200 * pulse));
+            } else if (r == selectedRow && c == selectedCol) {
+                float pulse = 0.85f + 0.15f * std::sin(highlightTime * 3.0f);
+                boardRenderer.addRect(BoardRenderer::Layer::Animated, c * cellSize + 1, r * cellSize + 1,
+                                      cellSize - 2, cellSize - 2, sf::Color(100, 150, 255, 220 * pulse));
+            }
+        }
     }
+    boardRenderer.draw(window);
 
     // Instructions panel with modern design
     sf::RectangleShape instructionBg(sf::Vector2f(310, 480));
@@ -265,22 +193,12 @@ void SudokuGame::render(sf::RenderWindow& window) {
     instructionBg.setOutlineColor(sf::Color(100, 150, 200));
     window.draw(instructionBg);
     
-    sf::Text title;
-    title.setFont(font);
-    title.setString("SUDOKU");
-    title.setCharacterSize(42);
+    sf::Text& title = texts.get("SUDOKU", 42, sf::Text::Bold);
     title.setFillColor(sf::Color(50, 50, 80));
-    title.setStyle(sf::Text::Bold);
     title.setPosition(620.f, 75.f);
     window.draw(title);
     
-    sf::Text instructions;
-    instructions.setFont(font);
-    instructions.setCharacterSize(16);
-    instructions.setFillColor(sf::Color(60, 60, 70));
-    instructions.setPosition(575.f, 140.f);
-    instructions.setString(
-        "HOW TO PLAY\n\n"
+    sf::Text& instructions = texts.get("HOW TO PLAY\n\n"
         "\x95 Click to select cell\n"
         "\x95 Type 1-9 to fill\n"
         "\x95 Delete to clear\n\n"
@@ -293,10 +211,16 @@ void SudokuGame::render(sf::RenderWindow& window) {
         "\x95 Black - Fixed\n"
         "\x95 Blue - Your input\n"
         "\x95 Red - Conflict!\n\n"
-        "ESC - Exit Game"
-    );
+        "N New | D Level | ESC Exit", 16);
+    instructions.setFillColor(sf::Color(60, 60, 70));
+    instructions.setPosition(575.f, 140.f);
     window.draw(instructions);
     
+    sf::Text& level = texts.get(SudokuSolver::difficultyName(engine.getDifficulty()), 16, sf::Text::Bold);
+    level.setFillColor(sf::Color(100, 150, 200));
+    level.setPosition(850.f - level.getLocalBounds().width, 140.f);
+    window.draw(level);
+    
     // Show selected cell info with modern styling
     if (selectedRow >= 0 && selectedCol >= 0) {
         sf::RectangleShape infoBg(sf::Vector2f(200, 35));
@@ -304,19 +228,17 @@ void SudokuGame::render(sf::RenderWindow& window) {
         infoBg.setFillColor(sf::Color(100, 150, 255, 200));
         window.draw(infoBg);
         
-        sf::Text cellInfo;
-        cellInfo.setFont(font);
-        cellInfo.setString("Cell: (" + std::to_string(selectedRow + 1) + ", " + std::to_string(selectedCol + 1) + ")");
-        cellInfo.setCharacterSize(18);
+        char cellLabel[32];
+        std::snprintf(cellLabel, sizeof(cellLabel), "Cell: (%d, %d)", selectedRow + 1, selectedCol + 1);
+        sf::Text& cellInfo = texts.get(cellLabel, 18, sf::Text::Bold);
         cellInfo.setFillColor(sf::Color::White);
-        cellInfo.setStyle(sf::Text::Bold);
         cellInfo.setPosition(640.f, 502.f);
         window.draw(cellInfo);
     }
     
-    if (gameOver) {
+    if (engine.isFinished()) {
         // Celebration overlay
-        float overlayAlpha = std::min(180.0f, gameOverTimer * 250.0f);
+        float overlayAlpha = std::min(180.0f, gameOverTime * 250.0f);
         sf::RectangleShape overlay(sf::Vector2f(540, 540));
         overlay.setPosition(0, 0);
         overlay.setFillColor(sf::Color(255, 255, 255, overlayAlpha * 0.9f));
@@ -329,42 +251,30 @@ void SudokuGame::render(sf::RenderWindow& window) {
         window.draw(msgBg);
         
         // Animated glow
-        sf::Text glowText;
-        glowText.setFont(font);
-        glowText.setString("PUZZLE SOLVED!");
-        glowText.setCharacterSize(48);
-        float pulse = 0.7f + 0.3f * std::sin(gameOverTimer * 4.0f);
+        float pulse = 0.7f + 0.3f * std::sin(gameOverTime * 4.0f);
+        sf::Text& glowText = texts.get("PUZZLE SOLVED!", 48, sf::Text::Bold);
         glowText.setFillColor(sf::Color(255, 255, 255, 200 * pulse));
-        glowText.setStyle(sf::Text::Bold);
         glowText.setPosition(72, 218);
         window.draw(glowText);
         
-        sf::Text text;
-        text.setFont(font);
-        text.setString("PUZZLE SOLVED!");
-        text.setCharacterSize(48);
+        sf::Text& text = texts.get("PUZZLE SOLVED!", 48, sf::Text::Bold);
         text.setFillColor(sf::Color::White);
-        text.setStyle(sf::Text::Bold);
         text.setPosition(70, 220);
         window.draw(text);
         
-        sf::Text subText;
-        subText.setFont(font);
-        subText.setString("View leaderboard or scoreboard");
-        subText.setCharacterSize(20);
+        sf::Text& subText = texts.get("View leaderboard or scoreboard", 20);
         subText.setFillColor(sf::Color(255, 255, 255, 240));
         subText.setPosition(85, 280);
         window.draw(subText);
         
         // Celebration particles
-        celebrationTimer += 0.016f;
         for (int i = 0; i < 30; ++i) {
-            float angle = (i / 30.0f) * 6.28318f + celebrationTimer * 1.5f;
-            float radius = 120 + 40 * std::sin(celebrationTimer * 3 + i * 0.5f);
+            float angle = (i / 30.0f) * 6.28318f + celebrationTime * 1.5f;
+            float radius = 120 + 40 * std::sin(celebrationTime * 3 + i * 0.5f);
             float x = 270 + radius * std::cos(angle);
             float y = 270 + radius * std::sin(angle);
             
-            sf::CircleShape particle(3 + 2 * std::sin(celebrationTimer * 2 + i));
+            sf::CircleShape particle(3 + 2 * std::sin(celebrationTime * 2 + i));
             particle.setPosition(x, y);
             int colorPhase = (i * 3) % 360;
             if (colorPhase < 120) particle.setFillColor(sf::Color(50, 200, 100, 220));
@@ -376,7 +286,7 @@ void SudokuGame::render(sf::RenderWindow& window) {
 }
 
 bool SudokuGame::isOver() const {
-    return gameOver && gameOverTimer >= 45.0f;
+    return engine.isFinished() && gameOverTimer >= 45.0f;
 }
 
 void SudokuGame::updateHover(sf::Vector2i mousePos) {
@@ -384,11 +294,13 @@ void SudokuGame::updateHover(sf::Vector2i mousePos) {
     int row = mousePos.y / cellSize;
     int col = mousePos.x / cellSize;
     
-    if (row >= 0 && row < 9 && col >= 0 && col < 9) {
+    if (row < 0 || row >= 9 || col < 0 || col >= 9) {
+        row = -1;
+        col = -1;
+    }
+    if (row != hoverRow || col != hoverCol) {
         hoverRow = row;
         hoverCol = col;
-    } else {
-        hoverRow = -1;
-        hoverCol = -1;
+        ++renderVersion;
     }
 }
@@ -0,0 +1,176 @@
+#include "../include/games/TicTacToeEngine.hpp"
+#include "../include/ai/TicTacToeRandomAI.hpp"
+#include "../include/ai/TicTacToePerfectAI.hpp"
+#include "../include/ai/MnkAlphaBetaAI.hpp"
+#include <chrono>
+
+TicTacToeEngine::TicTacToeEngine(Subject* subj, size_t rows, size_t cols, int k, const std::string& name)
+    : board(rows, cols, ' '), winLength(k), gameName(name), subject(subj) {}
+
+std::string TicTacToeEngine::getName() const {
+    return gameName;
+}
+
+void TicTacToeEngine::init() {
+    // A search still running reads the rng and the strategy; let it finish first
+    cancelAIMove();
+    beginSession();
+    board.reset(' ');
+    movesPlayed = 0;
+    currentPlayer = 'X';
+    gameOver = false;
+    winner = std::nullopt;
+    winLine = std::nullopt;
+    touch();
+    // initialize AI strategy if not present
+    if (!aiStrategy) {
+        setAIStrategy(smartAI);
+    }
+}
+
+void TicTacToeEngine::setAIStrategy(bool smart) {
+    cancelAIMove();
+    smartAI = smart;
+    if (!smartAI) {
+        aiStrategy = std::make_unique<TicTacToeRandomAI>(rng);
+    } else if (board.getRows() == 3 && board.getCols() == 3 && winLength == 3) {
+        aiStrategy = std::make_unique<TicTacToePerfectAI>();
+    } else {
+        MnkAlphaBetaAI::Config config;
+        config.winLength = winLength;
+        config.timeLimitMs = aiTimeLimitMs;
+        config.maxDepth = aiMaxDepth;
+        aiStrategy = std::make_unique<MnkAlphaBetaAI>(config);
+    }
+}
+
+void TicTacToeEngine::setAILimits(int timeLimitMs, int maxDepth) {
+    aiTimeLimitMs = timeLimitMs;
+    aiMaxDepth = maxDepth;
+    if (aiStrategy) {
+        setAIStrategy(smartAI);
+    }
+}
+
+void TicTacToeEngine::setVsAI(bool enabled) {
+    vsAI = enabled;
+}
+
+bool TicTacToeEngine::placeMark(int row, int col) {
+    if (gameOver || isAITurn() || board.at(row, col) != ' ') {
+        return false;
+    }
+
+    play(row, col);
+    if (!gameOver) {
+        currentPlayer = (currentPlayer == 'X') ? 'O' : 'X';
+    }
+    return true;
+}
+
+void TicTacToeEngine::play(int row, int col) {
+    board.at(row, col) = currentPlayer;
+    ++movesPlayed;
+    touch();
+    recordAction(row * static_cast<int>(board.getCols()) + col);
+    if (subject) {
+        subject->notifyMoveMade(gameName, row * static_cast<int>(board.getCols()) + col, row, col, currentPlayer);
+    }
+    checkWinner(row, col);
+}
+
+void TicTacToeEngine::checkWinner(int row, int col) {
+    // Only lines through the last move can have been completed
+    if (auto line = MnkRules::findWin(board, row, col, winLength)) {
+        winner = board.at(row, col);
+        gameOver = true;
+        winLine = line;
+        if (subject) {
+            subject->notifyGameOver(getName(), std::string("Winner: ") + winner.value());
+        }
+        return;
+    }
+
+    // Check for draw
+    if (movesPlayed == static_cast<int>(board.getRows() * board.getCols())) {
+        gameOver = true;
+        if (subject) {
+            subject->notifyGameOver(getName(), "Draw");
+        }
+    }
+}
+
+bool TicTacToeEngine::isAITurn() const {
+    // Replays already hold the AI's moves, which may depend on timing
+    return vsAI && !gameOver && currentPlayer == aiSymbol && aiStrategy && !isReplaying();
+}
+
+bool TicTacToeEngine::playAICell(int cell) {
+    if (cell < 0 || board.at(cell / board.getCols(), cell % board.getCols()) != ' ') return false;
+    play(cell / static_cast<int>(board.getCols()), cell % static_cast<int>(board.getCols()));
+    if (!gameOver) {
+        currentPlayer = (aiSymbol == 'X') ? 'O' : 'X';
+    }
+    return true;
+}
+
+bool TicTacToeEngine::playAIMove() {
+    cancelAIMove();
+    if (!isAITurn()) return false;
+    return playAICell(aiStrategy->chooseMove(board, aiSymbol));
+}
+
+void TicTacToeEngine::requestAIMove() {
+    if (pendingAIMove.valid() || !isAITurn()) return;
+    // The search works on a copy, so the view can keep drawing the live board
+    pendingAIMoveNumber = movesPlayed;
+    pendingAIMove = std::async(std::launch::async,
+        [strategy = aiStrategy.get(), position = board, symbol = aiSymbol]() {
+            return strategy->chooseMove(position, symbol);
+        });
+}
+
+bool TicTacToeEngine::pollAIMove() {
+    if (!pendingAIMove.valid() ||
+        pendingAIMove.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        return false;
+    }
+    const int cell = pendingAIMove.get();
+    if (movesPlayed != pendingAIMoveNumber || !isAITurn()) return false;
+    return playAICell(cell);
+}
+
+void TicTacToeEngine::cancelAIMove() {
+    if (pendingAIMove.valid()) {
+        pendingAIMove.wait();
+        pendingAIMove = std::future<int>();
+    }
+}
+
+std::vector<int> TicTacToeEngine::getLegalActions() const {
+    std::vector<int> actions;
+    if (gameOver) {
+        return actions;
+    }
+    const int cols = static_cast<int>(board.getCols());
+    for (int r = 0; r < static_cast<int>(board.getRows()); ++r) {
+        for (int c = 0; c < cols; ++c) {
+            if (board(r, c) == ' ') {
+                actions.push_back(r * cols + c);
+            }
+        }
+    }
+    return actions;
+}
+
+bool TicTacToeEngine::applyAction(int action) {
+    const int cols = static_cast<int>(board.getCols());
+    if (gameOver || action < 0 || action >= static_cast<int>(board.getRows()) * cols) {
+        return false;
+    }
+    return placeMark(action / cols, action % cols);
+}
+
+bool TicTacToeEngine::isFinished() const {
+    return gameOver;
+}
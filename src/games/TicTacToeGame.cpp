@@ -1,38 +1,49 @@
 #include "../include/games/TicTacToeGame.hpp"
-#include "../include/ai/TicTacToeRandomAI.hpp"
-#include <sstream>
+#include <algorithm>
 #include <cmath>
 
-TicTacToeGame::TicTacToeGame(Subject* subj)
-    : board(3, 3, ' '), currentPlayer('X'), gameOver(false), subject(subj) {}
+TicTacToeGame::TicTacToeGame(Subject* subj, size_t rows, size_t cols, int k, const std::string& name)
+    : engine(subj, rows, cols, k, name),
+      instructionText("How to Play\n\n"
+                      "\x95 Click empty cell\n"
+                      "\x95 Hover to preview\n"
+                      "\x95 Get " + std::to_string(k) + " in a row\n"
+                      "\x95 X vs O (AI)\n\n"
+                      "Controls:\n"
+                      "\x95 'A' - Toggle AI\n"
+                      "\x95 'P' - Smart/Random AI\n"
+                      "\x95 'R' - Restart\n"
+                      "\x95 ESC - Exit") {}
 
 std::string TicTacToeGame::getName() const {
-    return "Tic-Tac-Toe";
+    return engine.getName();
+}
+
+float TicTacToeGame::getCellSize() const {
+    const Grid<char>& board = engine.getBoard();
+    return 600.0f / std::max(board.getRows(), board.getCols());
 }
 
 void TicTacToeGame::init() {
-    board.reset(' ');
-    currentPlayer = 'X';
-    gameOver = false;
+    engine.init();
     gameOverTimer = 0.f;
     winLineTimer = 0.f;
-    hasWinLine = false;
-    winner = std::nullopt;
-    // initialize AI strategy if not present
-    if (!aiStrategy) {
-        aiStrategy = std::make_unique<TicTacToeRandomAI>();
-    }
-    
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        // Try alternative font paths
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
+}
+
+void TicTacToeGame::ensureFontLoaded() {
+    if (fontLoaded) {
+        return;
     }
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
     
     // Enable smooth font rendering for better scaling
-    const_cast<sf::Texture&>(font.getTexture(100)).setSmooth(true);
+    const_cast<sf::Texture&>(font->getTexture(100)).setSmooth(true);
+    fontLoaded = true;
 }
 
 void TicTacToeGame::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
+    const bool gameOver = engine.isFinished();
     if (event.type == sf::Event::MouseButtonPressed && !gameOver) {
         if (event.mouseButton.button == sf::Mouse::Left) {
             handleClick(sf::Mouse::getPosition(window), window);
@@ -48,224 +59,157 @@ void TicTacToeGame::handleEvent(const sf::Event& event, sf::RenderWindow& window
             init();
         }
         if (event.key.code == sf::Keyboard::A) {
-            // toggle AI mode
-            vsAI = !vsAI;
-            // if it's AI's turn right now, let it move
-            if (!gameOver && vsAI && currentPlayer == aiSymbol) {
-                performAIMove();
-            }
+            // toggle AI mode; update() asks for a reply if it is the AI's turn
+            engine.setVsAI(!engine.isVsAI());
+        }
+        if (event.key.code == sf::Keyboard::P) {
+            // switch between smart and random AI
+            engine.setAIStrategy(!engine.isSmartAI());
         }
     }
 }
 
 void TicTacToeGame::handleClick(sf::Vector2i pos, sf::RenderWindow& window) {
-    float cellSize = 200.0f;
+    float cellSize = getCellSize();
     int row = pos.y / cellSize;
     int col = pos.x / cellSize;
     
-    if (row >= 0 && row < 3 && col >= 0 && col < 3) {
-        if (board.at(row, col) == ' ') {
-            board.at(row, col) = currentPlayer;
-            checkWinner();
-            if (!gameOver) {
-                currentPlayer = (currentPlayer == 'X') ? 'O' : 'X';
-                // if AI is enabled and it's AI's turn, let the AI play immediately
-                if (vsAI && currentPlayer == aiSymbol) {
-                    performAIMove();
-                }
-            }
-        }
+    const Grid<char>& board = engine.getBoard();
+    if (row >= 0 && row < static_cast<int>(board.getRows()) && col >= 0 && col < static_cast<int>(board.getCols())) {
+        engine.placeMark(row, col);
     }
 }
 
-void TicTacToeGame::checkWinner() {
-    // Check rows
-    for (size_t r = 0; r < 3; ++r) {
-        if (board.at(r, 0) != ' ' && 
-            board.at(r, 0) == board.at(r, 1) && 
-            board.at(r, 1) == board.at(r, 2)) {
-            winner = board.at(r, 0);
-            gameOver = true;
-            hasWinLine = true;
-            winLineStartRow = r; winLineStartCol = 0;
-            winLineEndRow = r; winLineEndCol = 2;
-            if (subject) {
-                subject->notifyGameOver(getName(), std::string("Winner: ") + winner.value());
-            }
-            return;
-        }
+void TicTacToeGame::update(float dt) {
+    // The AI searches on a worker thread; its reply lands on a later update
+    engine.requestAIMove();
+    engine.pollAIMove();
+    pulseTimer += dt;
+    if (engine.isFinished()) {
+        gameOverTimer += dt;
+        winLineTimer += dt;
     }
-    
-    // Check columns
-    for (size_t c = 0; c < 3; ++c) {
-        if (board.at(0, c) != ' ' && 
-            board.at(0, c) == board.at(1, c) && 
-            board.at(1, c) == board.at(2, c)) {
-            winner = board.at(0, c);
-            gameOver = true;
-            hasWinLine = true;
-            winLineStartRow = 0; winLineStartCol = c;
-            winLineEndRow = 2; winLineEndCol = c;
-            if (subject) {
-                subject->notifyGameOver(getName(), std::string("Winner: ") + winner.value());
-            }
-            return;
-        }
+}
+
+bool TicTacToeGame::isAnimating() const {
+    if (engine.isFinished() || engine.isAITurn()) {
+        return true;
     }
+    return hoverRow >= 0 && hoverCol >= 0 && engine.getBoard()(hoverRow, hoverCol) == ' ';
+}
+
+void TicTacToeGame::rebuildBoardLayers() {
+    using Layer = BoardRenderer::Layer;
+    const Grid<char>& board = engine.getBoard();
+    const bool gameOver = engine.isFinished();
+    const size_t rows = board.getRows();
+    const size_t cols = board.getCols();
+    const float cellSize = getCellSize();
+    const float scale = cellSize / 200.0f;  // Layout below was designed for 3x3 cells of 200px
     
-    // Check diagonals
-    if (board.at(0, 0) != ' ' && 
-        board.at(0, 0) == board.at(1, 1) && 
-        board.at(1, 1) == board.at(2, 2)) {
-        winner = board.at(0, 0);
-        gameOver = true;
-        hasWinLine = true;
-        winLineStartRow = 0; winLineStartCol = 0;
-        winLineEndRow = 2; winLineEndCol = 2;
-        if (subject) {
-            subject->notifyGameOver(getName(), std::string("Winner: ") + winner.value());
-        }
-        return;
-    }
+    // Gradient background
+    boardRenderer.addRect(Layer::Background, 0, 0, 600, 300, sf::Color(240, 248, 255));
+    boardRenderer.addRect(Layer::Background, 0, 300, 600, 300, sf::Color(230, 240, 250));
     
-    if (board.at(0, 2) != ' ' && 
-        board.at(0, 2) == board.at(1, 1) && 
-        board.at(1, 1) == board.at(2, 0)) {
-        winner = board.at(0, 2);
-        gameOver = true;
-        hasWinLine = true;
-        winLineStartRow = 0; winLineStartCol = 2;
-        winLineEndRow = 2; winLineEndCol = 0;
-        if (subject) {
-            subject->notifyGameOver(getName(), std::string("Winner: ") + winner.value());
+    // Cells with shadows; the hovered empty cell pulses and is filled each frame in render()
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < cols; ++c) {
+            boardRenderer.addRect(Layer::Shadows, c * cellSize + 8 * scale, r * cellSize + 8 * scale,
+                                  cellSize - 8 * scale, cellSize - 8 * scale, sf::Color(0, 0, 0, 30));
+            
+            const bool hovered = static_cast<int>(r) == hoverRow && static_cast<int>(c) == hoverCol && board.at(r, c) == ' ' && !gameOver;
+            boardRenderer.addOutlinedRect(Layer::Cells, c * cellSize + 5 * scale, r * cellSize + 5 * scale,
+                                          cellSize - 10 * scale, cellSize - 10 * scale,
+                                          hovered ? sf::Color::Transparent : sf::Color(255, 255, 255, 250),
+                                          std::max(1.0f, 3 * scale), sf::Color(70, 130, 180, 200));
         }
-        return;
     }
     
-    // Check for draw
-    bool full = true;
-    for (size_t r = 0; r < 3; ++r) {
-        for (size_t c = 0; c < 3; ++c) {
-            if (board.at(r, c) == ' ') {
-                full = false;
-                break;
-            }
-        }
+    // Grid lines
+    const float lineWidth = std::max(2.0f, 6 * scale);
+    for (size_t i = 1; i < rows; ++i) {
+        boardRenderer.addRect(Layer::Overlay, 0, i * cellSize - lineWidth / 2, cols * cellSize, lineWidth,
+                              sf::Color(50, 100, 150, 180));
+    }
+    for (size_t i = 1; i < cols; ++i) {
+        boardRenderer.addRect(Layer::Overlay, i * cellSize - lineWidth / 2, 0, lineWidth, rows * cellSize,
+                              sf::Color(50, 100, 150, 180));
     }
     
-    if (full) {
-        gameOver = true;
-        if (subject) {
-            subject->notifyGameOver(getName(), "Draw");
+    // X's and O's with glow
+    const unsigned glowSize = static_cast<unsigned>(110 * scale);
+    const unsigned symbolSize = static_cast<unsigned>(100 * scale);
+    for (size_t r = 0; r < rows; ++r) {
+        for (size_t c = 0; c < cols; ++c) {
+            const char mark = board.at(r, c);
+            if (mark == ' ') continue;
+            const std::string label(1, mark);
+            boardRenderer.addText(*font, label, glowSize, true,
+                                  sf::Vector2f(c * cellSize + 45 * scale, r * cellSize + 25 * scale),
+                                  mark == 'X' ? sf::Color(0, 100, 255, 100) : sf::Color(255, 50, 50, 100));
+            boardRenderer.addText(*font, label, symbolSize, true,
+                                  sf::Vector2f(c * cellSize + 50 * scale, r * cellSize + 30 * scale),
+                                  mark == 'X' ? sf::Color(0, 120, 255) : sf::Color(255, 60, 60));
         }
     }
 }
 
-void TicTacToeGame::update(float dt) {
-    pulseTimer += dt;
-    if (gameOver) {
-        gameOverTimer += dt;
-        winLineTimer += dt;
-    }
-}
-
-void TicTacToeGame::render(sf::RenderWindow& window) {
-    float cellSize = 200.0f;
+void TicTacToeGame::render(sf::RenderWindow& window, float interpolation) {
+    ensureFontLoaded();
     
-    // Draw gradient background
-    sf::RectangleShape bgTop(sf::Vector2f(600, 300));
-    bgTop.setPosition(0, 0);
-    bgTop.setFillColor(sf::Color(240, 248, 255));
-    window.draw(bgTop);
+    // Animation timers advance in fixed steps; draw them where they are between steps
+    const float frameOffset = interpolation * UpdateStep;
+    const float pulseTime = pulseTimer + frameOffset;
+    const float gameOverTime = gameOverTimer + frameOffset;
+    const float winLineTime = winLineTimer + frameOffset;
     
-    sf::RectangleShape bgBottom(sf::Vector2f(600, 300));
-    bgBottom.setPosition(0, 300);
-    bgBottom.setFillColor(sf::Color(230, 240, 250));
-    window.draw(bgBottom);
+    const Grid<char>& board = engine.getBoard();
+    const bool gameOver = engine.isFinished();
+    const char currentPlayer = engine.getCurrentPlayer();
+    const std::optional<char>& winner = engine.getWinner();
+    const float cellSize = getCellSize();
+    const float scale = cellSize / 200.0f;
     
-    // Draw cells with hover effects and shadows
-    for (size_t r = 0; r < 3; ++r) {
-        for (size_t c = 0; c < 3; ++c) {
-            // Shadow effect
-            sf::RectangleShape shadow(sf::Vector2f(cellSize - 8, cellSize - 8));
-            shadow.setPosition(c * cellSize + 8, r * cellSize + 8);
-            shadow.setFillColor(sf::Color(0, 0, 0, 30));
-            window.draw(shadow);
-            
-            sf::RectangleShape cell(sf::Vector2f(cellSize - 10, cellSize - 10));
-            cell.setPosition(c * cellSize + 5, r * cellSize + 5);
-            
-            if (r == hoverRow && c == hoverCol && board.at(r, c) == ' ' && !gameOver) {
-                float glow = 0.5f + 0.3f * std::sin(pulseTimer * 5.0f);
-                cell.setFillColor(sf::Color(100, 200, 255, 80 + 120 * glow));
-            } else {
-                cell.setFillColor(sf::Color(255, 255, 255, 250));
-            }
-            cell.setOutlineThickness(3);
-            cell.setOutlineColor(sf::Color(70, 130, 180, 200));
-            window.draw(cell);
-        }
+    // Both counters only grow, so their sum changes whenever either does
+    const std::uint64_t renderKey = renderVersion + engine.getVersion();
+    if (boardRenderer.needsRebuild(renderKey)) {
+        boardRenderer.rebuild(renderKey);
+        rebuildBoardLayers();
     }
     
-    // Draw grid lines with gradient effect
-    for (int i = 1; i < 3; ++i) {
-        sf::RectangleShape line(sf::Vector2f(600, 6));
-        line.setPosition(0, i * cellSize - 3);
-        line.setFillColor(sf::Color(50, 100, 150, 180));
-        window.draw(line);
-        
-        line.setSize(sf::Vector2f(6, 600));
-        line.setPosition(i * cellSize - 3, 0);
-        window.draw(line);
+    // Hover glow and move preview pulse every frame
+    boardRenderer.clearLayer(BoardRenderer::Layer::Animated);
+    const bool hoveringEmpty = hoverRow >= 0 && hoverCol >= 0 && !gameOver &&
+                               board.at(hoverRow, hoverCol) == ' ';
+    if (hoveringEmpty) {
+        float glow = 0.5f + 0.3f * std::sin(pulseTime * 5.0f);
+        boardRenderer.addRect(BoardRenderer::Layer::Animated, hoverCol * cellSize + 5 * scale,
+                              hoverRow * cellSize + 5 * scale, cellSize - 10 * scale, cellSize - 10 * scale,
+                              sf::Color(100, 200, 255, 80 + 120 * glow));
     }
+    boardRenderer.draw(window);
     
-    // Draw X's and O's with enhanced effects and glow
-    for (size_t r = 0; r < 3; ++r) {
-        for (size_t c = 0; c < 3; ++c) {
-            if (board.at(r, c) != ' ') {
-                // Glow effect
-                sf::Text glow;
-                glow.setFont(font);
-                glow.setString(std::string(1, board.at(r, c)));
-                glow.setCharacterSize(110);
-                sf::Color glowColor = board.at(r, c) == 'X' ? sf::Color(0, 100, 255, 100) : sf::Color(255, 50, 50, 100);
-                glow.setFillColor(glowColor);
-                glow.setPosition(c * cellSize + 45, r * cellSize + 25);
-                glow.setStyle(sf::Text::Bold);
-                window.draw(glow);
-                
-                // Main symbol
-                sf::Text text;
-                text.setFont(font);
-                text.setString(std::string(1, board.at(r, c)));
-                text.setCharacterSize(100);
-                text.setFillColor(board.at(r, c) == 'X' ? sf::Color(0, 120, 255) : sf::Color(255, 60, 60));
-                text.setPosition(c * cellSize + 50, r * cellSize + 30);
-                text.setStyle(sf::Text::Bold);
-                window.draw(text);
-            } else if (r == hoverRow && c == hoverCol && !gameOver) {
-                // Show preview of next move
-                sf::Text preview;
-                preview.setFont(font);
-                preview.setString(std::string(1, currentPlayer));
-                preview.setCharacterSize(90);
-                sf::Color previewColor = currentPlayer == 'X' ? sf::Color(0, 120, 255) : sf::Color(255, 60, 60);
-                float alpha = 60 + 40 * std::sin(pulseTimer * 4.0f);
-                previewColor.a = alpha;
-                preview.setFillColor(previewColor);
-                preview.setPosition(c * cellSize + 55, r * cellSize + 40);
-                window.draw(preview);
-            }
-        }
+    if (hoveringEmpty) {
+        // Show preview of next move
+        sf::Text preview;
+        preview.setFont(*font);
+        preview.setString(std::string(1, currentPlayer));
+        preview.setCharacterSize(static_cast<unsigned>(90 * scale));
+        sf::Color previewColor = currentPlayer == 'X' ? sf::Color(0, 120, 255) : sf::Color(255, 60, 60);
+        float alpha = 60 + 40 * std::sin(pulseTime * 4.0f);
+        previewColor.a = alpha;
+        preview.setFillColor(previewColor);
+        preview.setPosition(hoverCol * cellSize + 55 * scale, hoverRow * cellSize + 40 * scale);
+        window.draw(preview);
     }
     
     // Draw winning line animation
-    if (gameOver && winner.has_value() && hasWinLine) {
-        float progress = std::min(1.0f, winLineTimer * 2.0f);
-        float startX = winLineStartCol * cellSize + cellSize / 2;
-        float startY = winLineStartRow * cellSize + cellSize / 2;
-        float endX = winLineEndCol * cellSize + cellSize / 2;
-        float endY = winLineEndRow * cellSize + cellSize / 2;
+    if (const auto& winLine = engine.getWinLine()) {
+        float progress = std::min(1.0f, winLineTime * 2.0f);
+        float startX = winLine->startCol * cellSize + cellSize / 2;
+        float startY = winLine->startRow * cellSize + cellSize / 2;
+        float endX = winLine->endCol * cellSize + cellSize / 2;
+        float endY = winLine->endRow * cellSize + cellSize / 2;
         
         float currentEndX = startX + (endX - startX) * progress;
         float currentEndY = startY + (endY - startY) * progress;
@@ -295,22 +239,9 @@ void TicTacToeGame::render(sf::RenderWindow& window) {
     instructionBg.setOutlineColor(sf::Color(70, 130, 180));
     window.draw(instructionBg);
     
-    sf::Text instructions;
-    instructions.setFont(font);
-    instructions.setCharacterSize(18);
+    sf::Text& instructions = texts.get(instructionText, 18);
     instructions.setFillColor(sf::Color(30, 30, 30));
     instructions.setPosition(620.f, 110.f);
-    instructions.setString(
-        "How to Play\n\n"
-        "\x95 Click empty cell\n"
-        "\x95 Hover to preview\n"
-        "\x95 Get 3 in a row\n"
-        "\x95 X vs O (AI)\n\n"
-        "Controls:\n"
-        "\x95 'A' - Toggle AI\n"
-        "\x95 'R' - Restart\n"
-        "\x95 ESC - Exit"
-    );
     window.draw(instructions);
 
     // Current player indicator with glow
@@ -320,12 +251,8 @@ void TicTacToeGame::render(sf::RenderWindow& window) {
         turnBg.setFillColor(currentPlayer == 'X' ? sf::Color(0, 120, 255, 200) : sf::Color(255, 60, 60, 200));
         window.draw(turnBg);
         
-        sf::Text playerTurn;
-        playerTurn.setFont(font);
-        playerTurn.setString(std::string("Turn: ") + currentPlayer);
-        playerTurn.setCharacterSize(28);
+        sf::Text& playerTurn = texts.get(currentPlayer == 'X' ? "Turn: X" : "Turn: O", 28, sf::Text::Bold);
         playerTurn.setFillColor(sf::Color::White);
-        playerTurn.setStyle(sf::Text::Bold);
         playerTurn.setPosition(660.f, 415.f);
         window.draw(playerTurn);
     }
@@ -333,65 +260,46 @@ void TicTacToeGame::render(sf::RenderWindow& window) {
     // Draw animated game over message
     if (gameOver) {
         // Background overlay with fade
-        float alpha = std::min(200.0f, gameOverTimer * 300.0f);
+        float alpha = std::min(200.0f, gameOverTime * 300.0f);
         sf::RectangleShape overlay(sf::Vector2f(800, 150));
         overlay.setPosition(50, 500);
         overlay.setFillColor(sf::Color(0, 0, 0, alpha * 0.8f));
         window.draw(overlay);
         
+        const char* message = winner.has_value() ? "You won! View leaderboard or scoreboard" : "Draw! Press ESC";
+        
         // Glow effect
-        sf::Text glowText;
-        glowText.setFont(font);
-        if (winner.has_value()) {
-            glowText.setString("You won! View leaderboard or scoreboard");
-        } else {
-            glowText.setString("Draw! Press ESC");
-        }
-        glowText.setCharacterSize(32);
-        float pulse = 0.7f + 0.3f * std::sin(gameOverTimer * 3.0f);
+        sf::Text& glowText = texts.get(message, 32);
+        float pulse = 0.7f + 0.3f * std::sin(gameOverTime * 3.0f);
         glowText.setFillColor(sf::Color(255, 255, 0, alpha * pulse));
         glowText.setPosition(78, 548);
         window.draw(glowText);
         
         // Main text
-        sf::Text text;
-        text.setFont(font);
-        if (winner.has_value()) {
-            text.setString("You won! View leaderboard or scoreboard");
-        } else {
-            text.setString("Draw! Press ESC");
-        }
-        text.setCharacterSize(32);
+        sf::Text& text = texts.get(message, 32, sf::Text::Bold);
         text.setFillColor(winner.has_value() ? sf::Color(50, 255, 50) : sf::Color(255, 255, 100));
-        text.setStyle(sf::Text::Bold);
         text.setPosition(80, 550);
         window.draw(text);
     }
 }
 
 bool TicTacToeGame::isOver() const {
-    return gameOver && gameOverTimer >= 45.0f;
+    return engine.isFinished() && gameOverTimer >= 45.0f;
 }
 
 void TicTacToeGame::updateHover(sf::Vector2i mousePos) {
-    float cellSize = 200.0f;
+    const Grid<char>& board = engine.getBoard();
+    float cellSize = getCellSize();
     int row = mousePos.y / cellSize;
     int col = mousePos.x / cellSize;
     
-    if (row >= 0 && row < 3 && col >= 0 && col < 3) {
+    if (row < 0 || row >= static_cast<int>(board.getRows()) || col < 0 || col >= static_cast<int>(board.getCols())) {
+        row = -1;
+        col = -1;
+    }
+    if (row != hoverRow || col != hoverCol) {
         hoverRow = row;
         hoverCol = col;
-    } else {
-        hoverRow = -1;
-        hoverCol = -1;
-    }
-}
-
-void TicTacToeGame::performAIMove() {
-    if (!vsAI || gameOver || currentPlayer != aiSymbol || !aiStrategy) return;
-    aiStrategy->makeMove(board, aiSymbol);
-    checkWinner();
-    if (!gameOver) {
-        currentPlayer = 'X';
+        ++renderVersion;  // Hovered cell swaps its static fill for the animated glow
     }
 }
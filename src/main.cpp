@@ -1,39 +1,77 @@
 #include "core/GameFactory.hpp"
 #include "core/GameManager.hpp"
 #include "core/ScreenManager.hpp"
-#include "games/TicTacToeGame.hpp"
-#include "games/SudokuGame.hpp"
-#include "games/Puzzle2048Game.hpp"
+#include "games/BuiltinGames.hpp"
 #include "util/ScoreBoard.hpp"
+#include "util/FileManager.hpp"
+#include "util/FrameProfiler.hpp"
+#include "util/Replay.hpp"
 #include "observer/Subject.hpp"
+#include "ui/FramePacer.hpp"
+#include "ui/ProfilerOverlay.hpp"
 #include "ui/SplashScreen.hpp"
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <iostream>
+#include <string>
+
+namespace {
+/**
+ * Play a replay file in a window (scores are not recorded)
+ */
+int playReplay(const std::string& path, float actionsPerSecond) {
+    Replay replay;
+    if (!replay.load(path)) {
+        return 1;
+    }
+    Subject subject;
+    GameFactory factory;
+    BuiltinGames::registerAll(factory, subject);
+    auto game = factory.create(replay.game);
+    if (!game) {
+        std::cerr << "Unknown game in replay: " << replay.game << std::endl;
+        return 1;
+    }
+    GameManager gameManager;
+    gameManager.setGame(std::move(game), replay.game);
+    gameManager.runReplay(replay, actionsPerSecond);
+    return 0;
+}
+}
 
 /**
  * Main entry point for the Modular Puzzle Game Studio
  * Demonstrates Factory, Strategy, Observer, and other OOP design patterns
+ * Usage: GameStudio [--replay FILE [--speed ACTIONS_PER_SECOND]]
  */
-int main() {
+int main(int argc, char* argv[]) {
     try {
-        // Create subject for observer pattern
-        Subject gameSubject;
+        std::string replayFile;
+        float replaySpeed = 4.f;
+        for (int i = 1; i + 1 < argc; i += 2) {
+            const std::string arg = argv[i];
+            if (arg == "--replay") {
+                replayFile = argv[i + 1];
+            } else if (arg == "--speed") {
+                replaySpeed = std::stof(argv[i + 1]);
+            }
+        }
+        if (!replayFile.empty()) {
+            return playReplay(replayFile, replaySpeed);
+        }
+
+        // Create scoreboard
+        // (a converted binary score log takes precedence over the text file)
+        ScoreBoard scoreBoard(FileManager::fileExists("scores.bin") ? "scores.bin" : "scores.txt");
         
-        // Create scoreboard and register as observer
-        ScoreBoard scoreBoard("scores.txt");
+        // Create subject for observer pattern and register the scoreboard;
+        // declared after it so queued events are delivered before it is destroyed
+        Subject gameSubject;
         gameSubject.addObserver(&scoreBoard);
         
         // Create game factory and register games
         GameFactory factory;
-        factory.registerGame("Tic-Tac-Toe", [&gameSubject]() {
-            return std::make_unique<TicTacToeGame>(&gameSubject);
-        });
-        factory.registerGame("Sudoku", [&gameSubject]() {
-            return std::make_unique<SudokuGame>(&gameSubject);
-        });
-        factory.registerGame("2048", [&gameSubject]() {
-            return std::make_unique<Puzzle2048Game>(&gameSubject);
-        });
+        BuiltinGames::registerAll(factory, gameSubject);
         
         // Create managers
         GameManager gameManager;
@@ -47,44 +85,86 @@ int main() {
         // Main application window with proper scaling
         sf::ContextSettings settings;
         settings.antialiasingLevel = 8; // High quality anti-aliasing
-        sf::RenderWindow window(sf::VideoMode(800, 600), "Modular Puzzle Game Studio", sf::Style::Default, settings);
+        // (created once; games run as screens inside it)
+        sf::RenderWindow window(sf::VideoMode(Screen::DefaultWidth, Screen::DefaultHeight), Screen::DefaultTitle,
+                                sf::Style::Default, settings);
         
         // Center the window on screen
         sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
-        window.setPosition(sf::Vector2i((desktop.width - 800) / 2, (desktop.height - 600) / 2));
+        window.setPosition(sf::Vector2i((desktop.width - Screen::DefaultWidth) / 2, (desktop.height - Screen::DefaultHeight) / 2));
         
         window.setFramerateLimit(60);
         sf::Clock clock;
+        FrameProfiler& profiler = FrameProfiler::instance();
+        FrameProfiler::Loop profilerLoop(profiler, "main");
+        ProfilerOverlay profilerOverlay(profiler);
         
-        // Main loop
+        // Main loop: draws only after input or when the screen asks for a
+        // frame, and otherwise sleeps until the next event or animation step
+        sf::Event event;
+        bool pendingEvent = false;   // Event received while waiting, not yet handled
         while (window.isOpen()) {
-            sf::Event event;
-            while (window.pollEvent(event)) {
-                if (event.type == sf::Event::Closed) {
-                    window.close();
-                } else if (event.type == sf::Event::Resized) {
-                    // Update view to match new window size
-                    sf::FloatRect visibleArea(0.f, 0.f, static_cast<float>(event.size.width), static_cast<float>(event.size.height));
-                    window.setView(sf::View(visibleArea));
+            profiler.beginFrame();
+            bool redraw = pendingEvent;
+            {
+                FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Events);
+                while (pendingEvent || window.pollEvent(event)) {
+                    pendingEvent = false;
+                    redraw = true;
+                    if (event.type == sf::Event::Closed) {
+                        window.close();
+                    } else if (event.type == sf::Event::Resized) {
+                        // Update view to match new window size
+                        sf::FloatRect visibleArea(0.f, 0.f, static_cast<float>(event.size.width), static_cast<float>(event.size.height));
+                        window.setView(sf::View(visibleArea));
 
-                } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
-                    // Return to splash screen on ESC (which will auto-advance to main menu)
-                    screenManager.setScreen(
-                        std::make_unique<SplashScreen>(screenManager, factory, gameManager, scoreBoard, gameSubject)
-                    );
-                } else {
-                    screenManager.handleEvent(event, window);
+                    } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape) {
+                        // Games leave to the main menu on ESC; other screens return to the
+                        // splash screen (which will auto-advance to main menu)
+                        if (!screenManager.handleEscape()) {
+                            screenManager.setScreen(
+                                std::make_unique<SplashScreen>(screenManager, factory, gameManager, scoreBoard, gameSubject)
+                            );
+                        }
+                    } else if (!profilerOverlay.handleEvent(event)) {
+                        screenManager.handleEvent(event, window);
+                    }
                 }
             }
             
             float dt = clock.restart().asSeconds();
-            screenManager.update(dt);
+            {
+                FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Update);
+                screenManager.update(dt);
+            }
             
-            window.clear(sf::Color::Black);
-            screenManager.render(window);
-            window.display();
+            redraw = redraw || screenManager.needsRedraw() || profilerOverlay.isVisible();
+            if (redraw && window.isOpen()) {
+                {
+                    FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Render);
+                    window.clear(sf::Color::Black);
+                    screenManager.render(window);
+                    profilerOverlay.render(window);
+                }
+                {
+                    FrameProfiler::Scope scope(profiler, FrameProfiler::Section::Display);
+                    window.display();
+                }
+            }
+            profiler.endFrame();
+            
+            float timeout = profilerOverlay.isVisible() ? 0.f : screenManager.getNextDeadline();
+            if (!redraw) {
+                timeout = std::max(timeout, FramePacer::MinWait);
+            }
+            if (timeout > 0.f && window.isOpen()) {
+                pendingEvent = FramePacer::waitEvent(window, event, timeout);
+            }
         }
         
+        // Deliver queued events, then write out scores still queued by the background writer
+        gameSubject.flush();
+        FileManager::shutdownWriter();
         std::cout << "Thank you for playing!" << std::endl;
         
     } catch (const std::exception& e) {
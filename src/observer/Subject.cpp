@@ -1,22 +1,152 @@
 #include "../include/observer/Subject.hpp"
 #include <algorithm>
+#include <chrono>
+
+Subject::Subject() : queue(std::make_unique<EventQueue>()) {}
+
+Subject::~Subject() {
+    {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    if (dispatcher.joinable()) {
+        dispatcher.join();
+    }
+}
 
 void Subject::addObserver(Observer* obs) {
-    if (obs) {
+    if (!obs) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(observersMutex);
         observers.push_back(obs);
+        updateEventMask();
+    }
+    if (!dispatcher.joinable()) {
+        dispatcher = std::thread(&Subject::dispatchLoop, this);
+        dispatcherId = dispatcher.get_id();
     }
 }
 
 void Subject::removeObserver(Observer* obs) {
+    flush();
+    std::lock_guard<std::mutex> lock(observersMutex);
     observers.erase(
         std::remove(observers.begin(), observers.end(), obs),
         observers.end()
     );
+    updateEventMask();
 }
 
-void Subject::notifyGameOver(const std::string& gameName, const std::string& result) {
+void Subject::updateEventMask() {
+    std::uint32_t mask = 0;
     for (Observer* obs : observers) {
-        obs->onGameOver(activePlayerName, gameName, result);
+        for (size_t type = 0; type < GameEvent::TypeCount; ++type) {
+            if (obs->wantsEvent(static_cast<GameEvent::Type>(type))) {
+                mask |= 1u << type;
+            }
+        }
+    }
+    eventMask.store(mask, std::memory_order_relaxed);
+}
+
+void Subject::publish(const GameEvent& event) {
+    if (!isListening(event.type)) {
+        return;
+    }
+    while (!queue->tryPush(event)) {
+        // Full: the dispatcher is behind, give it the core
+        stalls.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::yield();
+    }
+    published.fetch_add(1, std::memory_order_release);
+
+    // Pairs with the fence in dispatchLoop: either the dispatcher sees the
+    // event before sleeping or we see it idle and wake it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (dispatcherIdle.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(waitMutex);
+        wake.notify_one();
+    }
+}
+
+void Subject::notifyGameOver(std::string_view gameName, std::string_view result) {
+    publish(GameEvent::makeGameOver(gameName, activePlayerName, result));
+}
+
+void Subject::notifyMoveMade(std::string_view gameName, int action, int row, int col, char player) {
+    publish(GameEvent::makeMove(gameName, action, row, col, player));
+}
+
+void Subject::notifyTileMerged(std::string_view gameName, int row, int col, int value) {
+    publish(GameEvent::makeTileMerged(gameName, row, col, value));
+}
+
+void Subject::notifyCellFilled(std::string_view gameName, int row, int col, int value) {
+    publish(GameEvent::makeCellFilled(gameName, row, col, value));
+}
+
+void Subject::flush() {
+    if (!dispatcher.joinable() || std::this_thread::get_id() == dispatcherId) {
+        return;
+    }
+    const std::uint64_t target = published.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(waitMutex);
+    wake.notify_one();
+    drained.wait(lock, [this, target] { return dispatched >= target; });
+}
+
+void Subject::deliver(const GameEvent& event) {
+    if (event.type == GameEvent::Type::GameOver) {
+        const std::string player = event.gameOver.player.str();
+        const std::string game = event.game.str();
+        const std::string result = event.gameOver.result.str();
+        for (Observer* obs : observers) {
+            if (obs->wantsEvent(event.type)) {
+                obs->onGameOver(player, game, result);
+            }
+        }
+        return;
+    }
+    for (Observer* obs : observers) {
+        if (obs->wantsEvent(event.type)) {
+            obs->onEvent(event);
+        }
+    }
+}
+
+void Subject::dispatchLoop() {
+    GameEvent event;
+    while (true) {
+        std::uint64_t count = 0;
+        {
+            std::lock_guard<std::mutex> lock(observersMutex);
+            while (queue->tryPop(event)) {
+                deliver(event);
+                ++count;
+            }
+        }
+
+        std::unique_lock<std::mutex> lock(waitMutex);
+        if (count > 0) {
+            dispatched += count;
+            drained.notify_all();
+            continue;
+        }
+        if (stopping) {
+            if (queue->empty()) {
+                break;
+            }
+            continue;
+        }
+        dispatcherIdle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (queue->empty()) {
+            wake.wait_for(lock, std::chrono::milliseconds(100));
+        }
+        dispatcherIdle.store(false, std::memory_order_relaxed);
     }
 }
 
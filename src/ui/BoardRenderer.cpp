@@ -0,0 +1,154 @@
+#include "../include/ui/BoardRenderer.hpp"
+#include <algorithm>
+
+namespace {
+void appendQuad(sf::VertexArray& vertices, float left, float top, float right, float bottom, sf::Color color,
+                float texLeft = 0.f, float texTop = 0.f, float texRight = 0.f, float texBottom = 0.f) {
+    // Two triangles per quad: sf::Quads is deprecated since SFML 2.6 and removed in SFML 3
+    const sf::Vertex topLeft(sf::Vector2f(left, top), color, sf::Vector2f(texLeft, texTop));
+    const sf::Vertex topRight(sf::Vector2f(right, top), color, sf::Vector2f(texRight, texTop));
+    const sf::Vertex bottomLeft(sf::Vector2f(left, bottom), color, sf::Vector2f(texLeft, texBottom));
+    const sf::Vertex bottomRight(sf::Vector2f(right, bottom), color, sf::Vector2f(texRight, texBottom));
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+/**
+ * Walk the glyphs of a single-line string with sf::Text's layout rules
+ */
+template<typename Visit>
+void layoutGlyphs(const sf::Font& font, const std::string& text, unsigned characterSize, bool bold, Visit visit) {
+    float x = 0.f;
+    const float y = static_cast<float>(characterSize);  // Baseline of the first line
+    sf::Uint32 previous = 0;
+    for (unsigned char ch : text) {
+        const sf::Uint32 current = ch;
+        x += font.getKerning(previous, current, characterSize);
+        previous = current;
+        const sf::Glyph& glyph = font.getGlyph(current, characterSize, bold);
+        if (ch != ' ') {
+            visit(glyph, x, y);
+        }
+        x += glyph.advance;
+    }
+}
+}
+
+BoardRenderer::BoardRenderer() {
+    for (auto& layer : layers) {
+        layer.setPrimitiveType(sf::Triangles);
+    }
+}
+
+sf::VertexArray& BoardRenderer::batchFor(unsigned characterSize) {
+    for (auto& batch : textBatches) {
+        if (batch.characterSize == characterSize) return batch.vertices;
+    }
+    textBatches.push_back({characterSize, sf::VertexArray(sf::Triangles)});
+    return textBatches.back().vertices;
+}
+
+void BoardRenderer::rebuild(std::uint64_t stateKey) {
+    for (size_t i = 0; i < LayerCount; ++i) {
+        if (static_cast<Layer>(i) != Layer::Animated) {
+            layers[i].clear();
+        }
+    }
+    // Keep the batches so their vertex storage is reused
+    for (auto& batch : textBatches) {
+        batch.vertices.clear();
+    }
+    key = stateKey;
+    built = true;
+}
+
+void BoardRenderer::clearLayer(Layer layer) {
+    layers[static_cast<size_t>(layer)].clear();
+}
+
+void BoardRenderer::addRect(Layer layer, float x, float y, float width, float height, sf::Color color) {
+    appendQuad(layers[static_cast<size_t>(layer)], x, y, x + width, y + height, color);
+}
+
+void BoardRenderer::addOutlinedRect(Layer layer, float x, float y, float width, float height, sf::Color fill,
+                                    float outlineThickness, sf::Color outline) {
+    sf::VertexArray& vertices = layers[static_cast<size_t>(layer)];
+    if (outlineThickness > 0.f) {
+        const float t = outlineThickness;
+        appendQuad(vertices, x - t, y - t, x + width + t, y, outline);                    // Top
+        appendQuad(vertices, x - t, y + height, x + width + t, y + height + t, outline);  // Bottom
+        appendQuad(vertices, x - t, y, x, y + height, outline);                           // Left
+        appendQuad(vertices, x + width, y, x + width + t, y + height, outline);           // Right
+    }
+    appendQuad(vertices, x, y, x + width, y + height, fill);
+}
+
+void BoardRenderer::addText(const sf::Font& f, const std::string& text, unsigned characterSize, bool bold,
+                            sf::Vector2f position, sf::Color color) {
+    font = &f;
+    sf::VertexArray& vertices = batchFor(characterSize);
+    layoutGlyphs(f, text, characterSize, bold, [&](const sf::Glyph& glyph, float x, float y) {
+        const float left = position.x + x + glyph.bounds.left;
+        const float top = position.y + y + glyph.bounds.top;
+        const sf::IntRect& tex = glyph.textureRect;
+        appendQuad(vertices, left, top, left + glyph.bounds.width, top + glyph.bounds.height, color,
+                   static_cast<float>(tex.left), static_cast<float>(tex.top),
+                   static_cast<float>(tex.left + tex.width), static_cast<float>(tex.top + tex.height));
+    });
+}
+
+sf::FloatRect BoardRenderer::measureText(const sf::Font& f, const std::string& text, unsigned characterSize, bool bold) {
+    float minX = 0.f, minY = 0.f, maxX = 0.f, maxY = 0.f;
+    bool any = false;
+    layoutGlyphs(f, text, characterSize, bold, [&](const sf::Glyph& glyph, float x, float y) {
+        const float left = x + glyph.bounds.left;
+        const float top = y + glyph.bounds.top;
+        if (!any) {
+            minX = left;
+            minY = top;
+            maxX = left + glyph.bounds.width;
+            maxY = top + glyph.bounds.height;
+            any = true;
+        } else {
+            minX = std::min(minX, left);
+            minY = std::min(minY, top);
+            maxX = std::max(maxX, left + glyph.bounds.width);
+            maxY = std::max(maxY, top + glyph.bounds.height);
+        }
+    });
+    return sf::FloatRect(minX, minY, maxX - minX, maxY - minY);
+}
+
+void BoardRenderer::draw(sf::RenderTarget& target) const {
+    for (const auto& layer : layers) {
+        if (layer.getVertexCount() > 0) {
+            target.draw(layer);
+        }
+    }
+    if (!font) {
+        return;
+    }
+    for (const auto& batch : textBatches) {
+        if (batch.vertices.getVertexCount() == 0) continue;
+        sf::RenderStates states;
+        states.texture = &font->getTexture(batch.characterSize);
+        target.draw(batch.vertices, states);
+    }
+}
+
+size_t BoardRenderer::getDrawCallCount() const {
+    size_t calls = 0;
+    for (const auto& layer : layers) {
+        if (layer.getVertexCount() > 0) ++calls;
+    }
+    if (font) {
+        for (const auto& batch : textBatches) {
+            if (batch.vertices.getVertexCount() > 0) ++calls;
+        }
+    }
+    return calls;
+}
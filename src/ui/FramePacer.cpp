@@ -0,0 +1,19 @@
+#include "../include/ui/FramePacer.hpp"
+#include <algorithm>
+#include <cmath>
+
+bool FramePacer::waitEvent(sf::RenderWindow& window, sf::Event& event, float timeout) {
+    if (std::isinf(timeout)) {
+        return window.waitEvent(event);
+    }
+
+    sf::Clock clock;
+    while (!window.pollEvent(event)) {
+        const float remaining = timeout - clock.getElapsedTime().asSeconds();
+        if (remaining <= 0.f) {
+            return false;
+        }
+        sf::sleep(sf::seconds(std::min(remaining, PollInterval)));
+    }
+    return true;
+}
@@ -0,0 +1,59 @@
+#include "../include/ui/GameScreen.hpp"
+#include "../include/ui/MainMenuScreen.hpp"
+#include <iostream>
+#include <memory>
+
+GameScreen::GameScreen(GameFactory& f,
+                       GameManager& gm,
+                       ScoreBoard& sb,
+                       ScreenManager& sm,
+                       Subject& subj,
+                       Clock::time_point launch)
+    : factory(f), gameManager(gm), scoreBoard(sb), screenManager(sm), subject(subj), launchTime(launch) {
+    if (Game* game = gameManager.getCurrentGame()) {
+        title = game->getName();
+    }
+    gameManager.beginSession();
+}
+
+GameScreen::~GameScreen() {
+    gameManager.endSession();
+}
+
+void GameScreen::returnToMenu() {
+    if (leaving) {
+        return;
+    }
+    leaving = true;
+    screenManager.setScreen(std::make_unique<MainMenuScreen>(
+        factory, gameManager, scoreBoard, screenManager, subject));
+}
+
+void GameScreen::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
+    if (!leaving) {
+        gameManager.handleEvent(event, window);
+    }
+}
+
+bool GameScreen::handleEscape() {
+    // Leave the game immediately and return to the main menu
+    returnToMenu();
+    return true;
+}
+
+void GameScreen::update(float dt) {
+    gameManager.update(dt);
+    if (gameManager.isOver()) {
+        returnToMenu();
+    }
+}
+
+void GameScreen::render(sf::RenderWindow& window) {
+    gameManager.render(window);
+    if (!firstFrameDrawn) {
+        firstFrameDrawn = true;
+        const double switchMs = std::chrono::duration<double, std::milli>(Clock::now() - launchTime).count();
+        std::cout << "Switched to " << title << " in " << switchMs << " ms"
+                  << (switchMs > SwitchBudgetMs ? " (over the one-frame budget)" : "") << std::endl;
+    }
+}
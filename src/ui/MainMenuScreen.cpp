@@ -2,6 +2,7 @@
 #include "../include/ui/ScoreBoardScreen.hpp"
 #include "../include/ui/SettingsScreen.hpp"
 #include "../include/ui/NameEntryScreen.hpp"
+#include <algorithm>
 #include <memory>
 #include <random>
 #include <cmath>
@@ -12,12 +13,11 @@ MainMenuScreen::MainMenuScreen(GameFactory& f,
                                ScreenManager& sm,
                                Subject& subj)
     : factory(f), gameManager(gm), scoreBoard(sb), screenManager(sm), subject(subj), selectedIndex(0) {
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
     
     // Enable smooth font rendering
-    const_cast<sf::Texture&>(font.getTexture(30)).setSmooth(true);
+    const_cast<sf::Texture&>(font->getTexture(30)).setSmooth(true);
     
     menuItems = factory.getGameNames();
     menuItems.push_back("View Scores");
@@ -61,6 +61,7 @@ void MainMenuScreen::selectCurrentItem(sf::RenderWindow& window) {
 }
 
 void MainMenuScreen::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
+    idleSeconds = 0.f;
     if (event.type == sf::Event::KeyPressed) {
         if (event.key.code == sf::Keyboard::Up) {
             selectedIndex = (selectedIndex - 1 + menuItems.size()) % menuItems.size();
@@ -99,6 +100,11 @@ void MainMenuScreen::handleEvent(const sf::Event& event, sf::RenderWindow& windo
 }
 
 void MainMenuScreen::update(float dt) {
+    idleSeconds += dt;
+    if (idleSeconds >= AttractSeconds) {
+        return;  // Frozen until the next input
+    }
+    dt = std::min(dt, 0.1f);  // The first frame after an idle wait can be long
     glowTimer += dt;
     for (auto& particle : particles) {
         auto pos = particle.shape.getPosition();
@@ -132,29 +138,18 @@ void MainMenuScreen::render(sf::RenderWindow& window) {
     const float pulse = (std::sin(glowTimer * 2.f) + 1.f) * 0.5f;
     
     // Outer glow
-    sf::Text titleGlow;
-    titleGlow.setFont(font);
-    titleGlow.setString("Modular Puzzle Game Studio");
-    titleGlow.setCharacterSize(44);
+    sf::Text& titleGlow = texts.get("Modular Puzzle Game Studio", 44, sf::Text::Bold);
     titleGlow.setFillColor(sf::Color(150, 100, 255, 100 * pulse));
     titleGlow.setPosition(68, 38);
-    titleGlow.setStyle(sf::Text::Bold);
     window.draw(titleGlow);
     
     // Main title
-    sf::Text title;
-    title.setFont(font);
-    title.setString("Modular Puzzle Game Studio");
-    title.setCharacterSize(44);
+    sf::Text& title = texts.get("Modular Puzzle Game Studio", 44, sf::Text::Bold);
     title.setFillColor(sf::Color(200, static_cast<sf::Uint8>(120 + 135 * pulse), 255));
     title.setPosition(70, 40);
-    title.setStyle(sf::Text::Bold);
     window.draw(title);
     
-    sf::Text subtitle;
-    subtitle.setFont(font);
-    subtitle.setString("Press Enter on a game, then type your legend name to record scores!");
-    subtitle.setCharacterSize(18);
+    sf::Text& subtitle = texts.get("Press Enter on a game, then type your legend name to record scores!", 18);
     subtitle.setFillColor(sf::Color(220, 220, 240));
     subtitle.setPosition(70, 95);
     window.draw(subtitle);
@@ -165,12 +160,8 @@ void MainMenuScreen::render(sf::RenderWindow& window) {
     statsBg.setFillColor(sf::Color(80, 60, 120, 150));
     window.draw(statsBg);
     
-    sf::Text statsText;
-    statsText.setFont(font);
-    statsText.setString("Games Played: " + std::to_string(scoreBoard.getTotalGamesPlayed()));
-    statsText.setCharacterSize(18);
+    sf::Text& statsText = texts.getNumber("Games Played: ", scoreBoard.getTotalGamesPlayed(), 18, sf::Text::Bold);
     statsText.setFillColor(sf::Color(200, 200, 255));
-    statsText.setStyle(sf::Text::Bold);
     statsText.setPosition(620.f, 43.f);
     window.draw(statsText);
     
@@ -195,23 +186,15 @@ void MainMenuScreen::render(sf::RenderWindow& window) {
         window.draw(itemBg);
         
         // Draw shadow
-        sf::Text itemShadow;
-        itemShadow.setFont(font);
-        itemShadow.setString(menuItems[i]);
-        itemShadow.setCharacterSize(32);
+        sf::Text& itemShadow = texts.get(menuItems[i], 32, isSelected ? sf::Text::Bold : sf::Text::Regular);
         itemShadow.setFillColor(sf::Color(0, 0, 0, 80));
         itemShadow.setPosition(222, yPos + 2);
-        if (isSelected) itemShadow.setStyle(sf::Text::Bold);
         window.draw(itemShadow);
         
         // Draw menu item text
-        sf::Text item;
-        item.setFont(font);
-        item.setString(menuItems[i]);
-        item.setCharacterSize(32);
+        sf::Text& item = texts.get(menuItems[i], 32, isSelected ? sf::Text::Bold : sf::Text::Regular);
         item.setFillColor(isSelected ? sf::Color(255, 230, 100) : sf::Color(220, 220, 240));
         item.setPosition(220, yPos);
-        item.setStyle(isSelected ? sf::Text::Bold : sf::Text::Regular);
         window.draw(item);
         
         // Selection indicator
@@ -231,10 +214,7 @@ void MainMenuScreen::render(sf::RenderWindow& window) {
     instrBg.setFillColor(sf::Color(30, 25, 50, 180));
     window.draw(instrBg);
     
-    sf::Text instructions;
-    instructions.setFont(font);
-    instructions.setString("Use Arrow Keys to navigate | Enter to select | ESC returns here from anywhere | Hover & Click supported in games!");
-    instructions.setCharacterSize(16);
+    sf::Text& instructions = texts.get("Use Arrow Keys to navigate | Enter to select | ESC returns here from anywhere | Hover & Click supported in games!", 16);
     instructions.setFillColor(sf::Color(200, 200, 240));
     instructions.setPosition(50, 552);
     window.draw(instructions);
@@ -1,4 +1,5 @@
 #include "../include/ui/NameEntryScreen.hpp"
+#include "../include/ui/GameScreen.hpp"
 #include "../include/ui/MainMenuScreen.hpp"
 #include <memory>
 #include <utility>
@@ -9,10 +10,10 @@ NameEntryScreen::NameEntryScreen(GameFactory& f,
                                  ScreenManager& sm,
                                  Subject& subj,
                                  std::string targetGame)
-    : factory(f), gameManager(gm), scoreBoard(sb), screenManager(sm), subject(subj), gameName(std::move(targetGame)) {
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
+    : factory(f), gameManager(gm), scoreBoard(sb), screenManager(sm), subject(subj), gameName(std::move(targetGame)),
+      titleText("Enter your legend name for " + gameName) {
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
 }
 
 void NameEntryScreen::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
@@ -23,7 +24,7 @@ void NameEntryScreen::handleEvent(const sf::Event& event, sf::RenderWindow& wind
         }
     } else if (event.type == sf::Event::KeyPressed) {
         if (event.key.code == sf::Keyboard::Enter) {
-            launchGameAndReturn();
+            launchGame();
         } else if (event.key.code == sf::Keyboard::BackSpace && !playerName.empty()) {
             playerName.pop_back();
         }
@@ -32,13 +33,15 @@ void NameEntryScreen::handleEvent(const sf::Event& event, sf::RenderWindow& wind
 
 void NameEntryScreen::update(float dt) {
     caretTimer += dt;
-    if (caretTimer >= 0.5f) {
+    if (caretTimer >= CaretBlinkSeconds) {
         caretVisible = !caretVisible;
+        caretChanged = true;
         caretTimer = 0.f;
     }
 }
 
 void NameEntryScreen::render(sf::RenderWindow& window) {
+    caretChanged = false;
     window.clear(sf::Color(10, 10, 25));
 
     sf::RectangleShape panel({600.f, 250.f});
@@ -48,18 +51,12 @@ void NameEntryScreen::render(sf::RenderWindow& window) {
     panel.setPosition(100.f, 170.f);
     window.draw(panel);
 
-    sf::Text title;
-    title.setFont(font);
-    title.setString("Enter your legend name for " + gameName);
-    title.setCharacterSize(28);
+    sf::Text& title = texts.get(titleText, 28);
     title.setFillColor(sf::Color(220, 220, 255));
     title.setPosition(120.f, 190.f);
     window.draw(title);
 
-    sf::Text inputLabel;
-    inputLabel.setFont(font);
-    inputLabel.setString("Name:");
-    inputLabel.setCharacterSize(24);
+    sf::Text& inputLabel = texts.get("Name:", 24);
     inputLabel.setFillColor(sf::Color(180, 180, 220));
     inputLabel.setPosition(130.f, 260.f);
     window.draw(inputLabel);
@@ -71,10 +68,7 @@ void NameEntryScreen::render(sf::RenderWindow& window) {
     inputBox.setPosition(210.f, 250.f);
     window.draw(inputBox);
 
-    sf::Text nameText;
-    nameText.setFont(font);
-    nameText.setString(playerName.empty() ? "Player" : playerName);
-    nameText.setCharacterSize(26);
+    sf::Text& nameText = texts.get(playerName.empty() ? "Player" : playerName, 26);
     nameText.setFillColor(sf::Color::White);
     nameText.setPosition(225.f, 260.f);
     window.draw(nameText);
@@ -87,16 +81,14 @@ void NameEntryScreen::render(sf::RenderWindow& window) {
         window.draw(caret);
     }
 
-    sf::Text hint;
-    hint.setFont(font);
-    hint.setString("Tip: Keep it short (max 16 chars). Press Enter to begin!\nYour wins/losses will be tagged with this name on the scoreboard.");
-    hint.setCharacterSize(18);
+    sf::Text& hint = texts.get("Tip: Keep it short (max 16 chars). Press Enter to begin!\nYour wins/losses will be tagged with this name on the scoreboard.", 18);
     hint.setFillColor(sf::Color(200, 200, 200));
     hint.setPosition(130.f, 330.f);
     window.draw(hint);
 }
 
-void NameEntryScreen::launchGameAndReturn() {
+void NameEntryScreen::launchGame() {
+    const auto launchTime = GameScreen::Clock::now();
     std::string finalName = playerName;
     if (finalName.size() > 16) {
         finalName = finalName.substr(0, 16);
@@ -105,10 +97,11 @@ void NameEntryScreen::launchGameAndReturn() {
 
     auto game = factory.create(gameName);
     if (game) {
-        gameManager.setGame(std::move(game));
-        gameManager.run();
+        gameManager.setGame(std::move(game), gameName);
+        screenManager.setScreen(std::make_unique<GameScreen>(
+            factory, gameManager, scoreBoard, screenManager, subject, launchTime));
+    } else {
+        screenManager.setScreen(std::make_unique<MainMenuScreen>(
+            factory, gameManager, scoreBoard, screenManager, subject));
     }
-
-    screenManager.setScreen(std::make_unique<MainMenuScreen>(
-        factory, gameManager, scoreBoard, screenManager, subject));
 }
@@ -0,0 +1,79 @@
+#include "../include/ui/ProfilerOverlay.hpp"
+#include <cstdio>
+#include <iostream>
+
+ProfilerOverlay::ProfilerOverlay(FrameProfiler& prof) : profiler(prof) {}
+
+bool ProfilerOverlay::handleEvent(const sf::Event& event) {
+    if (event.type != sf::Event::KeyPressed) {
+        return false;
+    }
+    if (event.key.code == sf::Keyboard::F3) {
+        visible = !visible;
+        framesUntilRefresh = 0;
+        return true;
+    }
+    if (event.key.code == sf::Keyboard::F4) {
+        if (!profiler.isTracing()) {
+            profiler.startTrace();
+        } else {
+            profiler.stopTrace();
+            if (profiler.writeChromeTrace(TraceFile)) {
+                std::cout << "Wrote " << profiler.getTraceEventCount() << " trace events to " << TraceFile << std::endl;
+            }
+        }
+        framesUntilRefresh = 0;
+        return true;
+    }
+    return false;
+}
+
+void ProfilerOverlay::refresh() {
+    if (!font) {
+        font = ResourceCache::instance().acquireDefaultFont();
+        for (sf::Text& line : lines) {
+            line.setFont(*font);
+            line.setCharacterSize(13);
+            line.setFillColor(sf::Color(220, 220, 220));
+        }
+        lines[0].setFillColor(sf::Color(255, 215, 0));
+    }
+
+    char buffer[96];
+    std::snprintf(buffer, sizeof(buffer), "%s  (ms)    p50     p99     max%s",
+                  profiler.getLoopName(), profiler.isTracing() ? "  [REC]" : "");
+    lines[0].setString(buffer);
+    for (size_t s = 0; s < FrameProfiler::SectionCount; ++s) {
+        const auto section = static_cast<FrameProfiler::Section>(s);
+        const FrameProfiler::Summary summary = profiler.getSummary(section);
+        std::snprintf(buffer, sizeof(buffer), "%-8s %7.2f %7.2f %7.2f",
+                      FrameProfiler::sectionName(section), summary.p50Ms, summary.p99Ms, summary.maxMs);
+        lines[s + 1].setString(buffer);
+    }
+    lines[LineCount - 1].setString("F3 hide   F4 record trace");
+}
+
+void ProfilerOverlay::render(sf::RenderWindow& window) {
+    if (!visible) {
+        return;
+    }
+    if (--framesUntilRefresh <= 0) {
+        refresh();
+        framesUntilRefresh = RefreshFrames;
+    }
+
+    const float panelWidth = 290.f;
+    const float lineHeight = 17.f;
+    const sf::Vector2f viewSize = window.getView().getSize();
+    const sf::Vector2f origin(viewSize.x - panelWidth - 10.f, 10.f);
+
+    sf::RectangleShape panel({panelWidth, lineHeight * LineCount + 10.f});
+    panel.setPosition(origin);
+    panel.setFillColor(sf::Color(0, 0, 0, 170));
+    window.draw(panel);
+
+    for (size_t i = 0; i < LineCount; ++i) {
+        lines[i].setPosition(origin.x + 8.f, origin.y + 5.f + lineHeight * i);
+        window.draw(lines[i]);
+    }
+}
@@ -1,32 +1,52 @@
 #include "../include/ui/ScoreBoardScreen.hpp"
-#include <cmath>
-#include <unordered_map>
-#include <algorithm>
 
 ScoreBoardScreen::ScoreBoardScreen(ScoreBoard& sb, ScreenManager& sm)
     : scoreBoard(sb), screenManager(sm) {
     
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
+    font = ResourceCache::instance().acquireDefaultFont();
+    texts.setFont(*font);
 }
 
 void ScoreBoardScreen::handleEvent(const sf::Event& event, sf::RenderWindow& window) {
     // Main loop already listens for ESC to return to menu, no extra handling required here
 }
 
-void ScoreBoardScreen::update(float dt) {
-    animationTime += dt;
+void ScoreBoardScreen::update(float /*dt*/) {
+}
+
+bool ScoreBoardScreen::needsRedraw() const {
+    return scoreBoard.getTotalGamesPlayed() != shownGames;
+}
+
+void ScoreBoardScreen::refreshCards() {
+    const int totalGames = scoreBoard.getTotalGamesPlayed();
+    if (totalGames == shownGames) {
+        return;
+    }
+    shownGames = totalGames;
+    
+    recentCards.clear();
+    for (const auto& entry : scoreBoard.getRecentEntries(10)) {
+        recentCards.push_back({entry.playerName + " conquered " + entry.gameName,
+                               entry.result + "  |  " + entry.timestamp});
+    }
+    
+    legendCards.clear();
+    int rank = 1;
+    for (const auto& legend : scoreBoard.getTopPlayers(3)) {
+        legendCards.push_back({std::to_string(rank) + ". " + legend.first,
+                               std::to_string(legend.second) + " recorded feats"});
+        ++rank;
+    }
 }
 
 void ScoreBoardScreen::render(sf::RenderWindow& window) {
-    const float wave = std::sin(animationTime * 0.5f) * 30.f;
     sf::VertexArray gradient(sf::Quads, 4);
     gradient[0].position = {0.f, 0.f};
     gradient[1].position = {800.f, 0.f};
     gradient[2].position = {800.f, 600.f};
     gradient[3].position = {0.f, 600.f};
-    sf::Color topColor(30, 30, 80 + static_cast<int>(wave));
+    sf::Color topColor(30, 30, 80);
     sf::Color bottomColor(10, 10, 30);
     gradient[0].color = topColor;
     gradient[1].color = topColor;
@@ -35,66 +55,38 @@ void ScoreBoardScreen::render(sf::RenderWindow& window) {
     window.draw(gradient);
     
     // Title
-    sf::Text title;
-    title.setFont(font);
-    title.setString("Legendary Scores");
-    title.setCharacterSize(42);
+    sf::Text& title = texts.get("Legendary Scores", 42);
     title.setFillColor(sf::Color(255, 215, 0));
     title.setPosition(200, 25);
     window.draw(title);
     
-    auto entries = scoreBoard.getEntries();
-    std::unordered_map<std::string, int> playerCounts;
-    for (const auto& entry : entries) {
-        if (!entry.playerName.empty()) {
-            ++playerCounts[entry.playerName];
-        }
-    }
-    std::vector<std::pair<std::string, int>> legends(playerCounts.begin(), playerCounts.end());
-    std::sort(legends.begin(), legends.end(), [](const auto& a, const auto& b) {
-        if (a.second == b.second) {
-            return a.first < b.first;
-        }
-        return a.second > b.second;
-    });
-    if (legends.size() > 3) {
-        legends.resize(3);
-    }
-    if (entries.empty()) {
-        sf::Text noScores;
-        noScores.setFont(font);
-        noScores.setString("No champions recorded yet. Play a game!");
-        noScores.setCharacterSize(22);
+    refreshCards();
+    if (recentCards.empty()) {
+        sf::Text& noScores = texts.get("No champions recorded yet. Play a game!", 22);
         noScores.setFillColor(sf::Color(200, 200, 200));
         noScores.setPosition(120, 290);
         window.draw(noScores);
     } else {
         float yBase = 120.f;
         int displayed = 0;
-        for (auto it = entries.rbegin(); it != entries.rend() && displayed < 10; ++it, ++displayed) {
-            float offset = std::sin(animationTime * 2.f + displayed * 0.5f) * 5.f;
+        for (const auto& cardLines : recentCards) {
             sf::RectangleShape card({500.f, 60.f});
-            card.setPosition(40.f, yBase + displayed * 70.f + offset);
+            card.setPosition(40.f, yBase + displayed * 70.f);
             card.setFillColor(sf::Color(40, 40, 80, 220));
             card.setOutlineThickness(2.f);
             card.setOutlineColor(sf::Color(80 + displayed * 10, 120, 220));
             window.draw(card);
             
-            sf::Text playerLine;
-            playerLine.setFont(font);
-            playerLine.setCharacterSize(22);
+            sf::Text& playerLine = texts.get(cardLines.headline, 22);
             playerLine.setFillColor(sf::Color::White);
-            playerLine.setString(it->playerName + " conquered " + it->gameName);
             playerLine.setPosition(card.getPosition().x + 15.f, card.getPosition().y + 8.f);
             window.draw(playerLine);
             
-            sf::Text detailLine;
-            detailLine.setFont(font);
-            detailLine.setCharacterSize(16);
+            sf::Text& detailLine = texts.get(cardLines.detail, 16);
             detailLine.setFillColor(sf::Color(200, 200, 200));
-            detailLine.setString(it->result + "  |  " + it->timestamp);
             detailLine.setPosition(card.getPosition().x + 15.f, card.getPosition().y + 34.f);
             window.draw(detailLine);
+            ++displayed;
         }
     }
     sf::RectangleShape hallPanel({210.f, 360.f});
@@ -104,51 +96,34 @@ void ScoreBoardScreen::render(sf::RenderWindow& window) {
     hallPanel.setPosition(560.f, 140.f);
     window.draw(hallPanel);
 
-    sf::Text hallTitle;
-    hallTitle.setFont(font);
-    hallTitle.setString("Hall of Legends");
-    hallTitle.setCharacterSize(20);
+    sf::Text& hallTitle = texts.get("Hall of Legends", 20);
     hallTitle.setFillColor(sf::Color(255, 215, 0));
     hallTitle.setPosition(hallPanel.getPosition().x + 12.f, hallPanel.getPosition().y + 10.f);
     window.draw(hallTitle);
 
-    if (legends.empty()) {
-        sf::Text prompt;
-        prompt.setFont(font);
-        prompt.setString("No heroes yet.\nPlay and claim the board!");
-        prompt.setCharacterSize(16);
+    if (legendCards.empty()) {
+        sf::Text& prompt = texts.get("No heroes yet.\nPlay and claim the board!", 16);
         prompt.setFillColor(sf::Color(220, 220, 220));
         prompt.setPosition(hallPanel.getPosition().x + 12.f, hallPanel.getPosition().y + 50.f);
         window.draw(prompt);
     } else {
         float legendY = hallPanel.getPosition().y + 55.f;
-        int rank = 1;
-        for (const auto& legend : legends) {
-            sf::Text legendText;
-            legendText.setFont(font);
-            legendText.setCharacterSize(18);
+        for (const auto& legend : legendCards) {
+            sf::Text& legendText = texts.get(legend.headline, 18);
             legendText.setFillColor(sf::Color::White);
-            legendText.setString(std::to_string(rank) + ". " + legend.first);
             legendText.setPosition(hallPanel.getPosition().x + 12.f, legendY);
             window.draw(legendText);
 
-            sf::Text countText;
-            countText.setFont(font);
-            countText.setCharacterSize(16);
+            sf::Text& countText = texts.get(legend.detail, 16);
             countText.setFillColor(sf::Color(180, 200, 255));
-            countText.setString(std::to_string(legend.second) + " recorded feats");
             countText.setPosition(hallPanel.getPosition().x + 12.f, legendY + 24.f);
             window.draw(countText);
 
             legendY += 70.f;
-            ++rank;
         }
     }
     
-    sf::Text instructions;
-    instructions.setFont(font);
-    instructions.setString("Tip: Timer runs during games. Enter your name and rack up feats to reach the Hall of Legends. Press ESC to return.");
-    instructions.setCharacterSize(18);
+    sf::Text& instructions = texts.get("Tip: Timer runs during games. Enter your name and rack up feats to reach the Hall of Legends. Press ESC to return.", 18);
     instructions.setFillColor(sf::Color(220, 220, 220));
     instructions.setPosition(40.f, 540.f);
     window.draw(instructions);
@@ -10,17 +10,16 @@ SplashScreen::SplashScreen(ScreenManager& sm,
                           Subject& subj)
     : screenManager(sm), factory(f), gameManager(gm), scoreBoard(sb), subject(subj) {
     
-    if (!font.loadFromFile("assets/fonts/arial.ttf")) {
-        font.loadFromFile("C:/Windows/Fonts/arial.ttf");
-    }
+    font = ResourceCache::instance().acquireDefaultFont();
     
     // Try to load the Mindix logo
-    if (logoTexture.loadFromFile("Mindix.png")) {
+    logoTexture = ResourceCache::instance().acquireTexture("Mindix.png");
+    if (logoTexture) {
         logoLoaded = true;
-        logoSprite.setTexture(logoTexture);
+        logoSprite.setTexture(*logoTexture);
         
         // Center the logo
-        sf::Vector2u logoSize = logoTexture.getSize();
+        sf::Vector2u logoSize = logoTexture->getSize();
         logoSprite.setPosition(
             (800.f - logoSize.x) * 0.5f,
             (600.f - logoSize.y) * 0.5f - 80.f
@@ -97,7 +96,7 @@ void SplashScreen::render(sf::RenderWindow& window) {
     
     // "Developed by" text
     sf::Text developedBy;
-    developedBy.setFont(font);
+    developedBy.setFont(*font);
     developedBy.setString("Developed by");
     developedBy.setCharacterSize(28);
     sf::Color devColor(180, 180, 200);
@@ -108,7 +107,7 @@ void SplashScreen::render(sf::RenderWindow& window) {
     
     // "MINDIX" text with glow effect
     sf::Text mindix;
-    mindix.setFont(font);
+    mindix.setFont(*font);
     mindix.setString("MINDIX");
     mindix.setCharacterSize(48);
     mindix.setStyle(sf::Text::Bold);
@@ -122,7 +121,7 @@ void SplashScreen::render(sf::RenderWindow& window) {
     
     // Puzzle Game Studio subtitle
     sf::Text subtitle;
-    subtitle.setFont(font);
+    subtitle.setFont(*font);
     subtitle.setString("Puzzle Game Studio");
     subtitle.setCharacterSize(20);
     sf::Color subColor(150, 150, 180);
@@ -134,7 +133,7 @@ void SplashScreen::render(sf::RenderWindow& window) {
     // Skip instruction (fade in after 2 seconds)
     if (timer > 2.0f) {
         sf::Text skipText;
-        skipText.setFont(font);
+        skipText.setFont(*font);
         skipText.setString("Press any key to continue...");
         skipText.setCharacterSize(16);
         sf::Color skipColor(120, 120, 140);
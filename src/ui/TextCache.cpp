@@ -0,0 +1,72 @@
+#include "../include/ui/TextCache.hpp"
+#include <charconv>
+#include <functional>
+#include <iterator>
+
+size_t TextCache::KeyHash::operator()(const Key& key) const {
+    size_t h = std::hash<std::string>()(key.text);
+    h ^= (static_cast<size_t>(key.characterSize) << 8 | key.style) + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    return h;
+}
+
+TextCache::TextCache(size_t maxEntries) : capacity(maxEntries > 0 ? maxEntries : 1) {}
+
+void TextCache::setFont(const sf::Font& f) {
+    if (font != &f) {
+        font = &f;
+        clear();
+    }
+}
+
+sf::Text& TextCache::lookup() {
+    auto it = index.find(scratch);
+    if (it != index.end()) {
+        entries.splice(entries.begin(), entries, it->second);
+        return it->second->text;
+    }
+
+    if (entries.size() >= capacity) {
+        // Recycle the least recently used entry and its index node in place
+        auto node = index.extract(entries.back().key);
+        entries.splice(entries.begin(), entries, std::prev(entries.end()));
+        node.key() = scratch;
+        index.insert(std::move(node));
+    } else {
+        entries.emplace_front();
+        index.emplace(scratch, entries.begin());
+    }
+    Entry& entry = entries.front();
+    entry.key = scratch;
+    sf::Text& text = entry.text;
+    if (font) {
+        text.setFont(*font);
+    }
+    text.setString(scratch.text);
+    text.setCharacterSize(scratch.characterSize);
+    text.setStyle(scratch.style);
+    return text;
+}
+
+sf::Text& TextCache::get(const std::string& text, unsigned characterSize, sf::Uint32 style) {
+    scratch.text.assign(text);
+    scratch.characterSize = characterSize;
+    scratch.style = style;
+    return lookup();
+}
+
+sf::Text& TextCache::get(const char* text, unsigned characterSize, sf::Uint32 style) {
+    scratch.text.assign(text);
+    scratch.characterSize = characterSize;
+    scratch.style = style;
+    return lookup();
+}
+
+sf::Text& TextCache::getNumber(const char* prefix, long long value, unsigned characterSize, sf::Uint32 style) {
+    char digits[24];
+    auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    scratch.text.assign(prefix);
+    scratch.text.append(digits, result.ptr);
+    scratch.characterSize = characterSize;
+    scratch.style = style;
+    return lookup();
+}
@@ -0,0 +1,180 @@
+#include "../include/util/AsyncFileWriter.hpp"
+#include <cstdio>
+#include <iostream>
+#include <utility>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+void syncToDisk(std::FILE* file) {
+#ifdef _WIN32
+    _commit(_fileno(file));
+#else
+    fsync(fileno(file));
+#endif
+}
+}
+
+AsyncFileWriter::AsyncFileWriter() : config() {}
+
+AsyncFileWriter::AsyncFileWriter(const Config& cfg) : config(cfg) {}
+
+AsyncFileWriter::~AsyncFileWriter() {
+    shutdown();
+}
+
+void AsyncFileWriter::append(const std::string& filename, const std::string& line) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (stopped) {
+        std::vector<Pending> single{{filename, line}};
+        writeBatch(single, config.sync, config.sync != SyncPolicy::Never);
+        return;
+    }
+    if (!worker.joinable()) {
+        worker = std::thread(&AsyncFileWriter::run, this);
+    }
+    queue.push_back({filename, line});
+    ++enqueued;
+    if (queue.size() == 1 || queue.size() >= config.maxBatchLines) {
+        lock.unlock();
+        wake.notify_one();
+    }
+}
+
+void AsyncFileWriter::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!worker.joinable()) {
+        return;
+    }
+    // Wait for a pass that starts after this request: it writes everything
+    // queued so far and syncs every file written since the last sync
+    const std::uint64_t pass = passesStarted + 1;
+    ++flushRequests;
+    wake.notify_one();
+    drained.wait(lock, [this, pass] { return passesCompleted >= pass; });
+}
+
+void AsyncFileWriter::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopped) {
+            return;
+        }
+        stopping = true;
+    }
+    wake.notify_all();
+    if (worker.joinable()) {
+        worker.join();
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+}
+
+void AsyncFileWriter::setConfig(const Config& cfg) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        config = cfg;
+    }
+    wake.notify_one();
+}
+
+AsyncFileWriter::Config AsyncFileWriter::getConfig() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return config;
+}
+
+std::uint64_t AsyncFileWriter::getWrittenLines() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return written;
+}
+
+std::uint64_t AsyncFileWriter::getBatchCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return batches;
+}
+
+void AsyncFileWriter::run() {
+    std::vector<Pending> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wake.wait(lock, [this] { return stopping || flushRequests > 0 || !queue.empty(); });
+
+        // Let lines accumulate for up to the flush interval unless someone is waiting
+        if (!stopping && flushRequests == 0) {
+            wake.wait_for(lock, config.flushInterval, [this] {
+                return stopping || flushRequests > 0 || queue.size() >= config.maxBatchLines;
+            });
+        }
+
+        // setConfig may change the policy while the batch is written; take it now
+        const std::uint64_t pass = ++passesStarted;
+        const SyncPolicy sync = config.sync;
+        const bool syncAll = sync == SyncPolicy::Always ||
+                             (sync == SyncPolicy::OnFlush && (flushRequests > 0 || stopping));
+        flushRequests = 0;
+        batch.swap(queue);
+        const std::uint64_t target = enqueued;
+        lock.unlock();
+
+        writeBatch(batch, sync, syncAll);
+
+        lock.lock();
+        if (!batch.empty()) {
+            ++batches;
+        }
+        batch.clear();
+        written = target;
+        passesCompleted = pass;
+        drained.notify_all();
+        if (stopping && queue.empty()) {
+            break;
+        }
+    }
+}
+
+void AsyncFileWriter::writeBatch(std::vector<Pending>& batch, SyncPolicy sync, bool syncAll) {
+    // Group lines by file, keeping each file's lines in order
+    std::vector<std::pair<std::string, std::string>> files;
+    for (Pending& pending : batch) {
+        auto it = files.begin();
+        while (it != files.end() && it->first != pending.filename) {
+            ++it;
+        }
+        if (it == files.end()) {
+            files.emplace_back(std::move(pending.filename), std::string());
+            it = files.end() - 1;
+        }
+        it->second += pending.line;
+        it->second += '\n';
+    }
+
+    for (const auto& file : files) {
+        std::FILE* stream = std::fopen(file.first.c_str(), "ab");
+        if (!stream) {
+            std::cerr << "Unable to open file: " << file.first << std::endl;
+            continue;
+        }
+        std::fwrite(file.second.data(), 1, file.second.size(), stream);
+        std::fflush(stream);
+        if (syncAll) {
+            syncToDisk(stream);
+            unsynced.erase(file.first);
+        } else if (sync != SyncPolicy::Never) {
+            unsynced.insert(file.first);
+        }
+        std::fclose(stream);
+    }
+
+    if (syncAll) {
+        for (const std::string& filename : unsynced) {
+            if (std::FILE* stream = std::fopen(filename.c_str(), "ab")) {
+                syncToDisk(stream);
+                std::fclose(stream);
+            }
+        }
+        unsynced.clear();
+    }
+}
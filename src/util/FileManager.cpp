@@ -2,17 +2,19 @@
 #include <fstream>
 #include <iostream>
 
+namespace {
+AsyncFileWriter& writer() {
+    static AsyncFileWriter instance;
+    return instance;
+}
+}
+
 void FileManager::appendLine(const std::string& filename, const std::string& line) {
-    std::ofstream file(filename, std::ios::app);
-    if (file.is_open()) {
-        file << line << std::endl;
-        file.close();
-    } else {
-        std::cerr << "Unable to open file: " << filename << std::endl;
-    }
+    writer().append(filename, line);
 }
 
 std::vector<std::string> FileManager::readAllLines(const std::string& filename) {
+    writer().flush();
     std::vector<std::string> lines;
     std::ifstream file(filename);
     
@@ -33,3 +35,15 @@ bool FileManager::fileExists(const std::string& filename) {
     std::ifstream file(filename);
     return file.good();
 }
+
+void FileManager::flush() {
+    writer().flush();
+}
+
+void FileManager::configureWriter(const AsyncFileWriter::Config& config) {
+    writer().setConfig(config);
+}
+
+void FileManager::shutdownWriter() {
+    writer().shutdown();
+}
@@ -0,0 +1,161 @@
+#include "../include/util/FrameProfiler.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+std::int64_t toMicros(FrameProfiler::Clock::duration d) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(d).count();
+}
+}
+
+FrameProfiler::Scope::Scope(FrameProfiler& prof, Section sec)
+    : profiler(prof), section(sec), active(prof.enabled && !prof.activeLoops.empty()) {
+    if (active) {
+        excludedAtStart = profiler.excluded;
+        start = Clock::now();
+    }
+}
+
+FrameProfiler::Scope::~Scope() {
+    if (active) {
+        profiler.addSample(section, start, Clock::now(), excludedAtStart);
+    }
+}
+
+FrameProfiler::Loop::Loop(FrameProfiler& prof, const char* name) : profiler(prof), start(Clock::now()) {
+    auto it = std::find_if(profiler.loops.begin(), profiler.loops.end(),
+                           [name](const LoopStats& stats) { return std::strcmp(stats.name, name) == 0; });
+    if (it == profiler.loops.end()) {
+        profiler.loops.emplace_back();
+        profiler.loops.back().name = name;
+        it = profiler.loops.end() - 1;
+    }
+    profiler.activeLoops.push_back(static_cast<size_t>(it - profiler.loops.begin()));
+}
+
+FrameProfiler::Loop::~Loop() {
+    if (LoopStats* loop = profiler.currentLoop()) {
+        loop->inFrame = false;
+        loop->current.fill(Clock::duration::zero());
+    }
+    profiler.activeLoops.pop_back();
+    profiler.excluded += Clock::now() - start;
+}
+
+void FrameProfiler::Ring::push(std::uint32_t value) {
+    micros[next] = value;
+    next = (next + 1) % HistorySize;
+    count = std::min(count + 1, HistorySize);
+}
+
+FrameProfiler::FrameProfiler() : epoch(Clock::now()) {}
+
+FrameProfiler& FrameProfiler::instance() {
+    static FrameProfiler profiler;
+    return profiler;
+}
+
+FrameProfiler::LoopStats* FrameProfiler::currentLoop() {
+    return activeLoops.empty() ? nullptr : &loops[activeLoops.back()];
+}
+
+void FrameProfiler::addSample(Section section, Clock::time_point start, Clock::time_point end,
+                              Clock::duration excludedSince) {
+    LoopStats* loop = currentLoop();
+    if (!loop) {
+        return;
+    }
+    loop->current[static_cast<size_t>(section)] += (end - start) - (excluded - excludedSince);
+    if (tracing && trace.size() < MaxTraceEvents) {
+        trace.push_back({sectionName(section), loop->name, toMicros(start - epoch), toMicros(end - start)});
+    }
+}
+
+void FrameProfiler::beginFrame() {
+    LoopStats* loop = currentLoop();
+    if (!enabled || !loop) {
+        return;
+    }
+    loop->current.fill(Clock::duration::zero());
+    loop->excludedAtFrameStart = excluded;
+    loop->inFrame = true;
+    loop->frameStart = Clock::now();
+}
+
+void FrameProfiler::endFrame() {
+    LoopStats* loop = currentLoop();
+    if (!loop || !loop->inFrame) {
+        return;
+    }
+    loop->inFrame = false;
+    addSample(Section::Frame, loop->frameStart, Clock::now(), loop->excludedAtFrameStart);
+    for (size_t s = 0; s < SectionCount; ++s) {
+        const std::int64_t micros = std::max<std::int64_t>(0, toMicros(loop->current[s]));
+        loop->rings[s].push(static_cast<std::uint32_t>(std::min<std::int64_t>(micros, UINT32_MAX)));
+    }
+}
+
+FrameProfiler::Summary FrameProfiler::getSummary(Section section) const {
+    Summary summary;
+    if (activeLoops.empty()) {
+        return summary;
+    }
+    const Ring& ring = loops[activeLoops.back()].rings[static_cast<size_t>(section)];
+    if (ring.count == 0) {
+        return summary;
+    }
+
+    std::array<std::uint32_t, HistorySize> sorted;
+    std::copy(ring.micros.begin(), ring.micros.begin() + ring.count, sorted.begin());
+    std::sort(sorted.begin(), sorted.begin() + ring.count);
+    const auto percentile = [&](double p) {
+        // Nearest rank
+        size_t rank = static_cast<size_t>(p * ring.count + 0.999999);
+        rank = std::min(std::max<size_t>(rank, 1), ring.count);
+        return sorted[rank - 1] / 1000.0;
+    };
+    summary.p50Ms = percentile(0.50);
+    summary.p99Ms = percentile(0.99);
+    summary.maxMs = sorted[ring.count - 1] / 1000.0;
+    return summary;
+}
+
+const char* FrameProfiler::getLoopName() const {
+    return activeLoops.empty() ? "" : loops[activeLoops.back()].name;
+}
+
+void FrameProfiler::startTrace() {
+    trace.clear();
+    tracing = true;
+}
+
+bool FrameProfiler::writeChromeTrace(const std::string& filename) const {
+    std::ofstream out(filename, std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Unable to open file: " << filename << std::endl;
+        return false;
+    }
+
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t i = 0; i < trace.size(); ++i) {
+        const TraceEvent& event = trace[i];
+        out << "{\"name\":\"" << event.name << "\",\"cat\":\"" << event.loop
+            << "\",\"ph\":\"X\",\"ts\":" << event.startMicros << ",\"dur\":" << event.durationMicros
+            << ",\"pid\":1,\"tid\":1}" << (i + 1 < trace.size() ? ",\n" : "\n");
+    }
+    out << "]}\n";
+    return static_cast<bool>(out);
+}
+
+const char* FrameProfiler::sectionName(Section section) {
+    switch (section) {
+        case Section::Events: return "Events";
+        case Section::Update: return "Update";
+        case Section::Render: return "Render";
+        case Section::Display: return "Display";
+        case Section::Frame: return "Frame";
+    }
+    return "";
+}
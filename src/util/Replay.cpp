@@ -0,0 +1,63 @@
+#include "../include/util/Replay.hpp"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+namespace {
+constexpr char Magic[4] = {'G', 'S', 'R', 'P'};
+constexpr std::uint32_t ByteOrderMark = 0x01020304;
+constexpr size_t HeaderSize = 28;
+constexpr std::uint32_t MaxNameLength = 255;
+constexpr std::uint32_t MaxActions = 1u << 24;
+}
+
+bool Replay::save(const std::string& path) const {
+    std::string out(HeaderSize, '\0');
+    const std::uint32_t words[6] = {
+        ByteOrderMark, Version, seed, settings,
+        static_cast<std::uint32_t>(game.size()), static_cast<std::uint32_t>(actions.size())
+    };
+    std::memcpy(&out[0], Magic, 4);
+    std::memcpy(&out[4], words, sizeof(words));
+    out.append(game);
+    out.append(reinterpret_cast<const char*>(actions.data()), actions.size() * sizeof(std::uint16_t));
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Unable to open file: " << path << std::endl;
+        return false;
+    }
+    const bool written = std::fwrite(out.data(), 1, out.size(), file) == out.size();
+    return std::fclose(file) == 0 && written;
+}
+
+bool Replay::load(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        std::cerr << "Unable to open file: " << path << std::endl;
+        return false;
+    }
+
+    unsigned char header[HeaderSize];
+    std::uint32_t words[6] = {};
+    bool valid = std::fread(header, 1, HeaderSize, file) == HeaderSize && std::memcmp(header, Magic, 4) == 0;
+    if (valid) {
+        std::memcpy(words, header + 4, sizeof(words));
+        valid = words[0] == ByteOrderMark && words[1] == Version &&
+                words[4] <= MaxNameLength && words[5] <= MaxActions;
+    }
+    if (valid) {
+        seed = words[2];
+        settings = words[3];
+        game.assign(words[4], '\0');
+        actions.assign(words[5], 0);
+        valid = std::fread(&game[0], 1, game.size(), file) == game.size() &&
+                std::fread(actions.data(), sizeof(std::uint16_t), actions.size(), file) == actions.size();
+    }
+    std::fclose(file);
+
+    if (!valid) {
+        std::cerr << "Invalid replay: " << path << std::endl;
+    }
+    return valid;
+}
@@ -0,0 +1,83 @@
+#include "../include/util/ResourceCache.hpp"
+
+namespace {
+    const char* const DefaultFontPaths[] = {
+        "assets/fonts/arial.ttf",
+        "C:/Windows/Fonts/arial.ttf"
+    };
+
+    template<typename Map>
+    size_t purgeMap(Map& map) {
+        size_t released = 0;
+        for (auto it = map.begin(); it != map.end();) {
+            if (it->second.use_count() == 1) {
+                it = map.erase(it);
+                ++released;
+            } else {
+                ++it;
+            }
+        }
+        return released;
+    }
+}
+
+ResourceCache::ResourceCache() : placeholderFont(std::make_shared<sf::Font>()) {}
+
+ResourceCache& ResourceCache::instance() {
+    static ResourceCache cache;
+    return cache;
+}
+
+ResourceCache::FontHandle ResourceCache::acquireFont(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = fonts.find(filename);
+    if (it != fonts.end()) {
+        return it->second;
+    }
+
+    auto font = std::make_shared<sf::Font>();
+    if (!font->loadFromFile(filename)) {
+        return nullptr;
+    }
+    fonts.emplace(filename, font);
+    return font;
+}
+
+ResourceCache::FontHandle ResourceCache::acquireDefaultFont() {
+    for (const char* path : DefaultFontPaths) {
+        if (FontHandle font = acquireFont(path)) {
+            return font;
+        }
+    }
+    return placeholderFont;
+}
+
+ResourceCache::TextureHandle ResourceCache::acquireTexture(const std::string& filename) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = textures.find(filename);
+    if (it != textures.end()) {
+        return it->second;
+    }
+
+    auto texture = std::make_shared<sf::Texture>();
+    if (!texture->loadFromFile(filename)) {
+        return nullptr;
+    }
+    textures.emplace(filename, texture);
+    return texture;
+}
+
+size_t ResourceCache::purgeUnused() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return purgeMap(fonts) + purgeMap(textures);
+}
+
+size_t ResourceCache::getFontCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return fonts.size();
+}
+
+size_t ResourceCache::getTextureCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return textures.size();
+}
@@ -13,26 +13,44 @@ std::string trim(const std::string& text) {
     const auto last = text.find_last_not_of(" \t");
     return text.substr(first, last - first + 1);
 }
+
+bool isBinaryLog(const std::string& filename) {
+    return filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".bin") == 0;
+}
 }
 
 ScoreBoard::ScoreBoard(const std::string& file) : filename(file) {
-    if (!FileManager::fileExists(filename)) {
+    if (isBinaryLog(filename)) {
+        log.open(filename);
+    } else if (!FileManager::fileExists(filename)) {
         std::ofstream createFile(filename);
     }
+    load();
 }
 
-std::vector<ScoreBoard::ScoreEntry> ScoreBoard::getEntries() const {
-    std::vector<ScoreEntry> entries;
+void ScoreBoard::load() {
+    entriesLoaded = true;
+    if (isBinaryLog(filename)) {
+        if (log.isOpen()) {
+            entriesLoaded = false;
+            loadFromLog();
+        }
+        return;
+    }
+    
     auto lines = FileManager::readAllLines(filename);
     entries.reserve(lines.size());
+    std::vector<std::string> parts;
     for (const auto& line : lines) {
         if (line.empty()) continue;
         ScoreEntry entry;
-        std::vector<std::string> parts;
-        std::stringstream ss(line);
-        std::string segment;
-        while (std::getline(ss, segment, '|')) {
-            parts.push_back(trim(segment));
+        parts.clear();
+        size_t begin = 0;
+        while (begin < line.size()) {
+            size_t end = line.find('|', begin);
+            if (end == std::string::npos) end = line.size();
+            parts.push_back(trim(line.substr(begin, end - begin)));
+            begin = end + 1;
         }
         if (!parts.empty()) entry.timestamp = parts[0];
         if (parts.size() >= 2) entry.gameName = parts[1];
@@ -46,18 +64,82 @@ std::vector<ScoreBoard::ScoreEntry> ScoreBoard::getEntries() const {
             entry.playerName = "Unknown";
             entry.result = line;
         }
-        entries.push_back(entry);
+        record(std::move(entry));
+    }
+}
+
+void ScoreBoard::loadFromLog() {
+    // Count by string id straight from the mapped records, then fold the
+    // few distinct names into the maps
+    const size_t stringCount = log.stringCount();
+    std::vector<PlayerStats> byPlayer(stringCount);
+    std::vector<int> byGame(stringCount, 0);
+    for (size_t i = 0; i < log.size(); ++i) {
+        const ScoreLog::Record& rec = log.record(i);
+        PlayerStats& stats = byPlayer[rec.player];
+        ++stats.gamesPlayed;
+        const auto outcome = static_cast<ScoreLog::Outcome>(rec.outcome);
+        if (outcome == ScoreLog::Outcome::Text ? isWin(std::string(log.string(rec.result)))
+                                               : outcome != ScoreLog::Outcome::Draw) {
+            ++stats.wins;
+        }
+        ++byGame[rec.game];
+    }
+    for (std::uint32_t id = 0; id < stringCount; ++id) {
+        if (byPlayer[id].gamesPlayed > 0 && !log.string(id).empty()) {
+            PlayerStats& stats = players[std::string(log.string(id))];
+            stats.gamesPlayed += byPlayer[id].gamesPlayed;
+            stats.wins += byPlayer[id].wins;
+        }
+        if (byGame[id] > 0) {
+            gameCounts[std::string(log.string(id))] += byGame[id];
+        }
+    }
+    totalGames = static_cast<int>(log.size());
+}
+
+bool ScoreBoard::isWin(const std::string& result) {
+    return result.find("Winner") != std::string::npos ||
+           result.find("Solved") != std::string::npos ||
+           result.find("Score:") != std::string::npos;
+}
+
+void ScoreBoard::tally(const std::string& playerName, const std::string& gameName, bool win, int count) {
+    if (!playerName.empty()) {
+        PlayerStats& stats = players[playerName];
+        stats.gamesPlayed += count;
+        if (win) {
+            stats.wins += count;
+        }
+    }
+    gameCounts[gameName] += count;
+    totalGames += count;
+}
+
+void ScoreBoard::record(ScoreEntry entry) {
+    tally(entry.playerName, entry.gameName, isWin(entry.result));
+    if (entriesLoaded) {
+        entries.push_back(std::move(entry));
     }
-    return entries;
 }
 
 void ScoreBoard::addEntry(const ScoreEntry& entry) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (isBinaryLog(filename)) {
+        if (log.isOpen()) {
+            log.append(entry);
+        }
+        record(entry);
+        return;
+    }
+    
     std::ostringstream oss;
     oss << entry.timestamp << " | "
         << entry.gameName << " | "
         << entry.playerName << " | "
         << entry.result;
     FileManager::appendLine(filename, oss.str());
+    record(entry);
 }
 
 void ScoreBoard::onGameOver(const std::string& playerName,
@@ -78,21 +160,40 @@ void ScoreBoard::onGameOver(const std::string& playerName,
     addEntry(entry);
 }
 
-std::pair<int, std::string> ScoreBoard::getPlayerStats(const std::string& playerName) const {
-    auto entries = getEntries();
-    int count = 0;
-    int wins = 0;
-    
-    for (const auto& entry : entries) {
-        if (entry.playerName == playerName) {
-            count++;
-            if (entry.result.find("Winner") != std::string::npos || 
-                entry.result.find("Solved") != std::string::npos ||
-                entry.result.find("Score:") != std::string::npos) {
-                wins++;
-            }
+const std::vector<ScoreBoard::ScoreEntry>& ScoreBoard::getEntries() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!entriesLoaded) {
+        entries.reserve(log.size());
+        for (size_t i = 0; i < log.size(); ++i) {
+            entries.push_back(log.entry(i));
+        }
+        entriesLoaded = true;
+    }
+    return entries;
+}
+
+std::vector<ScoreBoard::ScoreEntry> ScoreBoard::getRecentEntries(size_t count) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<ScoreEntry> recent;
+    if (entriesLoaded) {
+        for (auto it = entries.rbegin(); it != entries.rend() && recent.size() < count; ++it) {
+            recent.push_back(*it);
+        }
+    } else {
+        for (size_t i = log.size(); i > 0 && recent.size() < count; --i) {
+            recent.push_back(log.entry(i - 1));
         }
     }
+    return recent;
+}
+
+int ScoreBoard::getTotalGamesPlayed() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalGames;
+}
+
+std::pair<int, std::string> ScoreBoard::getPlayerStats(const std::string& playerName) const {
+    const int count = getPlayerAggregates(playerName).gamesPlayed;
     
     std::string achievement;
     if (count >= 50) achievement = "Legendary Master";
@@ -104,6 +205,33 @@ std::pair<int, std::string> ScoreBoard::getPlayerStats(const std::string& player
     return {count, achievement};
 }
 
-int ScoreBoard::getTotalGamesPlayed() const {
-    return getEntries().size();
+ScoreBoard::PlayerStats ScoreBoard::getPlayerAggregates(const std::string& playerName) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = players.find(playerName);
+    return it != players.end() ? it->second : PlayerStats{};
+}
+
+int ScoreBoard::getGameCount(const std::string& gameName) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = gameCounts.find(gameName);
+    return it != gameCounts.end() ? it->second : 0;
+}
+
+std::vector<std::pair<std::string, int>> ScoreBoard::getTopPlayers(size_t count) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<std::pair<std::string, int>> top;
+    top.reserve(players.size());
+    for (const auto& player : players) {
+        top.emplace_back(player.first, player.second.gamesPlayed);
+    }
+    const auto byGames = [](const auto& a, const auto& b) {
+        if (a.second == b.second) {
+            return a.first < b.first;
+        }
+        return a.second > b.second;
+    };
+    count = std::min(count, top.size());
+    std::partial_sort(top.begin(), top.begin() + count, top.end(), byGames);
+    top.resize(count);
+    return top;
 }
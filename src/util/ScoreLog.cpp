@@ -0,0 +1,339 @@
+#include "../include/util/ScoreLog.hpp"
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace {
+constexpr char Magic[4] = {'S', 'C', 'L', 'G'};
+constexpr std::uint32_t ByteOrderMark = 0x01020304;
+constexpr std::uint32_t MaxStringLength = 0xFFFFFF;
+
+static_assert(sizeof(ScoreLog::Record) == 32, "ScoreLog records must be 32 bytes");
+
+size_t align8(size_t n) {
+    return (n + 7) & ~static_cast<size_t>(7);
+}
+
+std::uint32_t readU32(const unsigned char* p) {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+std::string formatResult(ScoreLog::Outcome outcome, std::int32_t value) {
+    switch (outcome) {
+        case ScoreLog::Outcome::Winner: return std::string("Winner: ") + static_cast<char>(value);
+        case ScoreLog::Outcome::Draw: return "Draw";
+        case ScoreLog::Outcome::Solved: return "Solved!";
+        case ScoreLog::Outcome::ScoreWon: return "Score: " + std::to_string(value) + " (Won!)";
+        case ScoreLog::Outcome::ScoreOver: return "Score: " + std::to_string(value) + " (Game Over)";
+        case ScoreLog::Outcome::Text: break;
+    }
+    return "";
+}
+
+bool parseNumber(const std::string& text, size_t pos, size_t length, int& out) {
+    if (pos + length > text.size()) return false;
+    for (size_t i = pos; i < pos + length; ++i) {
+        if (text[i] < '0' || text[i] > '9') return false;
+    }
+    const auto result = std::from_chars(text.data() + pos, text.data() + pos + length, out);
+    return result.ec == std::errc();
+}
+
+bool truncateFile(const std::string& path, size_t size) {
+#ifdef _WIN32
+    int fd = -1;
+    if (_sopen_s(&fd, path.c_str(), _O_RDWR | _O_BINARY, _SH_DENYNO, 0) != 0) return false;
+    const bool ok = _chsize_s(fd, static_cast<__int64>(size)) == 0;
+    _close(fd);
+    return ok;
+#else
+    return ::truncate(path.c_str(), static_cast<off_t>(size)) == 0;
+#endif
+}
+}
+
+bool ScoreLog::open(const std::string& path) {
+    valid = false;
+    filename = path;
+    strings.clear();
+    records.clear();
+    ids.clear();
+    validSize = HeaderSize;
+
+    if (std::FILE* probe = std::fopen(filename.c_str(), "rb")) {
+        std::fclose(probe);
+    } else {
+        std::FILE* out = std::fopen(filename.c_str(), "wb");
+        if (!out) {
+            std::cerr << "Unable to open file: " << filename << std::endl;
+            return false;
+        }
+        unsigned char header[HeaderSize] = {};
+        const std::uint32_t words[3] = {ByteOrderMark, Version, static_cast<std::uint32_t>(sizeof(Record))};
+        std::memcpy(header, Magic, 4);
+        std::memcpy(header + 4, words, sizeof(words));
+        const bool written = std::fwrite(header, 1, HeaderSize, out) == HeaderSize;
+        std::fclose(out);
+        if (!written) {
+            return false;
+        }
+    }
+
+    if (!file.open(filename)) {
+        return false;
+    }
+    const unsigned char* data = file.getData();
+    if (file.getSize() < HeaderSize || std::memcmp(data, Magic, 4) != 0 ||
+        readU32(data + 4) != ByteOrderMark || readU32(data + 8) != Version ||
+        readU32(data + 12) != sizeof(Record)) {
+        std::cerr << "Invalid score log: " << filename << std::endl;
+        file.close();
+        return false;
+    }
+
+    if (!indexChunks()) {
+        std::cerr << "Truncating damaged score log tail: " << filename << std::endl;
+        file.close();
+        if (!truncateFile(filename, validSize) || !file.open(filename)) {
+            return false;
+        }
+    }
+
+    valid = true;
+    return true;
+}
+
+bool ScoreLog::indexChunks() {
+    const unsigned char* data = file.getData();
+    const size_t size = file.getSize();
+    while (validSize + 4 <= size) {
+        const std::uint32_t tag = readU32(data + validSize);
+        if ((tag & 0xFF) == ChunkString) {
+            const std::uint32_t length = tag >> 8;
+            const size_t chunkSize = align8(4 + static_cast<size_t>(length));
+            if (validSize + chunkSize > size) break;
+            const auto id = static_cast<std::uint32_t>(strings.size());
+            strings.push_back({validSize + 4, length});
+            ids.emplace(std::string(reinterpret_cast<const char*>(data) + validSize + 4, length), id);
+            validSize += chunkSize;
+        } else if (tag == ChunkRecord) {
+            if (validSize + sizeof(Record) > size) break;
+            // Strings are always written before the records that use them
+            const Record& rec = *reinterpret_cast<const Record*>(data + validSize);
+            const size_t stringCount = strings.size();
+            const bool textResult = rec.outcome == static_cast<std::uint8_t>(Outcome::Text);
+            const bool textTimestamp = (rec.timestamp >> 42) == TimestampString;
+            if (rec.player >= stringCount || rec.game >= stringCount ||
+                (textResult && rec.result >= stringCount) ||
+                (textTimestamp && static_cast<std::uint32_t>(rec.timestamp) >= stringCount)) {
+                break;
+            }
+            records.push_back(validSize);
+            validSize += sizeof(Record);
+        } else {
+            break;
+        }
+    }
+    return validSize == size;
+}
+
+std::uint32_t ScoreLog::intern(const std::string& text, std::string& out, std::uint32_t& nextId,
+                               std::unordered_map<std::string, std::uint32_t>& added) const {
+    auto it = ids.find(text);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    auto pending = added.find(text);
+    if (pending != added.end()) {
+        return pending->second;
+    }
+
+    const std::uint32_t tag = ChunkString | (static_cast<std::uint32_t>(text.size()) << 8);
+    out.append(reinterpret_cast<const char*>(&tag), sizeof(tag));
+    out.append(text);
+    out.resize(align8(out.size()), '\0');
+    added.emplace(text, nextId);
+    return nextId++;
+}
+
+bool ScoreLog::append(const ScoreEntry& entry) {
+    return append(std::vector<ScoreEntry>{entry});
+}
+
+bool ScoreLog::append(const std::vector<ScoreEntry>& batch) {
+    if (!valid) {
+        return false;
+    }
+
+    std::string out;
+    out.reserve(batch.size() * sizeof(Record));
+    auto nextId = static_cast<std::uint32_t>(strings.size());
+    std::unordered_map<std::string, std::uint32_t> added;
+    for (const ScoreEntry& entry : batch) {
+        if (entry.playerName.size() > MaxStringLength || entry.gameName.size() > MaxStringLength ||
+            entry.result.size() > MaxStringLength || entry.timestamp.size() > MaxStringLength) {
+            return false;
+        }
+
+        Record rec{};
+        rec.tag = ChunkRecord;
+        rec.player = intern(entry.playerName, out, nextId, added);
+        rec.game = intern(entry.gameName, out, nextId, added);
+        const Outcome outcome = classify(entry.result, rec.value);
+        rec.outcome = static_cast<std::uint8_t>(outcome);
+        rec.result = outcome == Outcome::Text ? intern(entry.result, out, nextId, added) : NoString;
+        rec.timestamp = packTimestamp(entry.timestamp);
+        if (rec.timestamp == 0) {
+            rec.timestamp = (TimestampString << 42) | intern(entry.timestamp, out, nextId, added);
+        }
+        out.append(reinterpret_cast<const char*>(&rec), sizeof(rec));
+    }
+
+    // Unbuffered, so the whole batch reaches the file in one write call
+    std::FILE* stream = std::fopen(filename.c_str(), "ab");
+    if (!stream) {
+        std::cerr << "Unable to open file: " << filename << std::endl;
+        return false;
+    }
+    std::setvbuf(stream, nullptr, _IONBF, 0);
+    const bool written = std::fwrite(out.data(), 1, out.size(), stream) == out.size();
+    std::fclose(stream);
+    if (!written) {
+        return false;
+    }
+
+    // Remap and index only the new chunks
+    if (!file.open(filename)) {
+        valid = false;
+        return false;
+    }
+    indexChunks();
+    return true;
+}
+
+std::string_view ScoreLog::string(std::uint32_t id) const {
+    const StringRef& ref = strings[id];
+    return std::string_view(reinterpret_cast<const char*>(file.getData()) + ref.offset, ref.length);
+}
+
+std::string ScoreLog::resultText(const Record& rec) const {
+    const auto outcome = static_cast<Outcome>(rec.outcome);
+    if (outcome == Outcome::Text) {
+        return std::string(string(rec.result));
+    }
+    return formatResult(outcome, rec.value);
+}
+
+std::string ScoreLog::timestampText(const Record& rec) const {
+    if ((rec.timestamp >> 42) == TimestampString) {
+        return std::string(string(static_cast<std::uint32_t>(rec.timestamp)));
+    }
+    return formatTimestamp(rec.timestamp);
+}
+
+ScoreEntry ScoreLog::entry(size_t index) const {
+    const Record& rec = record(index);
+    ScoreEntry result;
+    result.timestamp = timestampText(rec);
+    result.playerName = std::string(string(rec.player));
+    result.gameName = std::string(string(rec.game));
+    result.result = resultText(rec);
+    return result;
+}
+
+ScoreLog::Outcome ScoreLog::classify(const std::string& result, std::int32_t& value) {
+    value = 0;
+    if (result == "Draw") {
+        return Outcome::Draw;
+    }
+    if (result == "Solved!") {
+        return Outcome::Solved;
+    }
+    if (result.size() == 9 && result.compare(0, 8, "Winner: ") == 0) {
+        value = static_cast<unsigned char>(result[8]);
+        return Outcome::Winner;
+    }
+    if (result.compare(0, 7, "Score: ") == 0 &&
+        std::from_chars(result.data() + 7, result.data() + result.size(), value).ec == std::errc()) {
+        // Only keep the numeric form when it reproduces the text exactly
+        for (Outcome candidate : {Outcome::ScoreWon, Outcome::ScoreOver}) {
+            if (formatResult(candidate, value) == result) {
+                return candidate;
+            }
+        }
+    }
+    value = 0;
+    return Outcome::Text;
+}
+
+std::uint64_t ScoreLog::packTimestamp(const std::string& text) {
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    std::uint64_t fields = 0;
+    if (text.size() == 4 && parseNumber(text, 0, 4, year)) {
+        fields = 1;
+    } else if ((text.size() == 10 || text.size() == 16 || text.size() == 19) &&
+               parseNumber(text, 0, 4, year) && text[4] == '-' &&
+               parseNumber(text, 5, 2, month) && text[7] == '-' && parseNumber(text, 8, 2, day)) {
+        fields = 3;
+        if (text.size() >= 16) {
+            if (text[10] != ' ' || !parseNumber(text, 11, 2, hour) || text[13] != ':' ||
+                !parseNumber(text, 14, 2, minute)) {
+                return 0;
+            }
+            fields = 5;
+        }
+        if (text.size() == 19) {
+            if (text[16] != ':' || !parseNumber(text, 17, 2, second)) {
+                return 0;
+            }
+            fields = 6;
+        }
+    } else {
+        return 0;
+    }
+
+    if ((fields >= 3 && (month < 1 || month > 12 || day < 1 || day > 31)) ||
+        hour > 23 || minute > 59 || second > 60) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(second) | (static_cast<std::uint64_t>(minute) << 6) |
+           (static_cast<std::uint64_t>(hour) << 12) | (static_cast<std::uint64_t>(day) << 17) |
+           (static_cast<std::uint64_t>(month) << 22) | (static_cast<std::uint64_t>(year) << 26) |
+           (fields << 42);
+}
+
+std::string ScoreLog::formatTimestamp(std::uint64_t packed) {
+    const auto field = [packed](int shift, int bits) {
+        return static_cast<int>((packed >> shift) & ((1u << bits) - 1));
+    };
+    const int fields = field(42, 3);
+    char buffer[32];
+    switch (fields) {
+        case 1:
+            std::snprintf(buffer, sizeof(buffer), "%04d", field(26, 16));
+            break;
+        case 3:
+            std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d", field(26, 16), field(22, 4), field(17, 5));
+            break;
+        case 5:
+            std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d",
+                          field(26, 16), field(22, 4), field(17, 5), field(12, 5), field(6, 6));
+            break;
+        case 6:
+            std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d",
+                          field(26, 16), field(22, 4), field(17, 5), field(12, 5), field(6, 6), field(0, 6));
+            break;
+        default:
+            return "";
+    }
+    return buffer;
+}
@@ -0,0 +1,119 @@
+#include "../include/util/SudokuPuzzleBank.hpp"
+#include <fstream>
+#include <iostream>
+
+namespace {
+constexpr char Magic[4] = {'S', 'D', 'K', 'B'};
+
+std::uint32_t readU32(const unsigned char* p) {
+    return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) |
+           (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+void writeU32(unsigned char* p, std::uint32_t value) {
+    p[0] = static_cast<unsigned char>(value);
+    p[1] = static_cast<unsigned char>(value >> 8);
+    p[2] = static_cast<unsigned char>(value >> 16);
+    p[3] = static_cast<unsigned char>(value >> 24);
+}
+}
+
+SudokuPuzzleBank::SudokuPuzzleBank(const std::string& filename) {
+    open(filename);
+}
+
+bool SudokuPuzzleBank::open(const std::string& filename) {
+    valid = false;
+    counts.fill(0);
+    offsets.fill(0);
+    if (!file.open(filename)) {
+        return false;
+    }
+
+    const unsigned char* data = file.getData();
+    if (file.getSize() < HeaderSize ||
+        data[0] != Magic[0] || data[1] != Magic[1] || data[2] != Magic[2] || data[3] != Magic[3] ||
+        readU32(data + 4) != Version || readU32(data + 8) != RecordSize) {
+        std::cerr << "Invalid puzzle bank: " << filename << std::endl;
+        file.close();
+        return false;
+    }
+
+    size_t offset = HeaderSize;
+    for (int d = 0; d < SudokuSolver::DifficultyCount; ++d) {
+        counts[d] = readU32(data + 12 + d * 4);
+        offsets[d] = offset;
+        offset += static_cast<size_t>(counts[d]) * RecordSize;
+    }
+    if (offset > file.getSize()) {
+        std::cerr << "Truncated puzzle bank: " << filename << std::endl;
+        file.close();
+        return false;
+    }
+
+    valid = true;
+    return true;
+}
+
+size_t SudokuPuzzleBank::count(Difficulty difficulty) const {
+    return valid ? counts[static_cast<int>(difficulty)] : 0;
+}
+
+std::optional<SudokuPuzzleBank::Puzzle> SudokuPuzzleBank::get(Difficulty difficulty, size_t index) const {
+    if (index >= count(difficulty)) {
+        return std::nullopt;
+    }
+    const unsigned char* record = file.getData() + offsets[static_cast<int>(difficulty)] + index * RecordSize;
+    Puzzle puzzle{};
+    // The record is untrusted: digits must be 0-9 and givens must not repeat in a row, column or box
+    std::array<std::uint16_t, 27> used{};
+    for (int idx = 0; idx < 81; ++idx) {
+        const unsigned char packed = record[idx / 2];
+        const auto digit = static_cast<std::uint8_t>((idx % 2 == 0) ? (packed & 0xF) : (packed >> 4));
+        puzzle[idx] = digit;
+        if (digit == 0) continue;
+        const int r = idx / 9;
+        const int c = idx % 9;
+        const std::uint16_t bit = static_cast<std::uint16_t>(1u << digit);
+        std::uint16_t& row = used[r];
+        std::uint16_t& col = used[9 + c];
+        std::uint16_t& box = used[18 + (r / 3) * 3 + c / 3];
+        if (digit > 9 || ((row | col | box) & bit) != 0) {
+            std::cerr << "Corrupt puzzle bank record " << index << std::endl;
+            return std::nullopt;
+        }
+        row |= bit;
+        col |= bit;
+        box |= bit;
+    }
+    return puzzle;
+}
+
+bool SudokuPuzzleBank::write(const std::string& filename,
+                             const std::array<std::vector<Puzzle>, SudokuSolver::DifficultyCount>& puzzles) {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Unable to open file: " << filename << std::endl;
+        return false;
+    }
+
+    unsigned char header[HeaderSize] = {};
+    for (int i = 0; i < 4; ++i) header[i] = static_cast<unsigned char>(Magic[i]);
+    writeU32(header + 4, Version);
+    writeU32(header + 8, RecordSize);
+    for (int d = 0; d < SudokuSolver::DifficultyCount; ++d) {
+        writeU32(header + 12 + d * 4, static_cast<std::uint32_t>(puzzles[d].size()));
+    }
+    out.write(reinterpret_cast<const char*>(header), HeaderSize);
+
+    for (const auto& section : puzzles) {
+        for (const Puzzle& puzzle : section) {
+            unsigned char record[RecordSize] = {};
+            for (int idx = 0; idx < 81; ++idx) {
+                record[idx / 2] |= static_cast<unsigned char>((puzzle[idx] & 0xF) << ((idx % 2) * 4));
+            }
+            out.write(reinterpret_cast<const char*>(record), RecordSize);
+        }
+    }
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,546 @@
+#include "core/EngineFactory.hpp"
+#include "core/ReplayPlayer.hpp"
+#include "games/BuiltinEngines.hpp"
+#include "games/Puzzle2048Engine.hpp"
+#include "games/SudokuEngine.hpp"
+#include "games/TicTacToeEngine.hpp"
+#include "ai/MnkAlphaBetaAI.hpp"
+#include "ai/Puzzle2048ExpectimaxAI.hpp"
+#include "ai/Puzzle2048MctsAI.hpp"
+#include "ai/SudokuSolver.hpp"
+#include "ai/TicTacToeMctsAI.hpp"
+#include "ai/TicTacToePerfectAI.hpp"
+#include "observer/Subject.hpp"
+#include "util/Replay.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Headless simulation runner
+ * Drives registered game engines through EngineFactory with random, AI or
+ * scripted moves. It links only the SFML-free core library, so it builds
+ * and runs on CI machines without a display or graphics stack. Reports
+ * games/second and per-move latency.
+ * Each game is seeded from --seed, so runs are reproducible; --record saves
+ * a game as a replay and --replay re-executes one at full speed.
+ */
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+// Time limit standing in for "none": the depth limit always ends the search first
+constexpr int UnlimitedOpponentMs = 24 * 60 * 60 * 1000;
+
+/**
+ * Fixed-size log-linear histogram of nanosecond latencies
+ * Each power of two is split into 16 buckets (~6% resolution),
+ * so memory stays constant no matter how many moves are recorded.
+ */
+class LatencyHistogram {
+private:
+    std::array<std::uint64_t, 1024> buckets{};
+    std::uint64_t count = 0;
+    std::uint64_t maxValue = 0;
+
+    static size_t bucketFor(std::uint64_t ns) {
+        if (ns < 16) return static_cast<size_t>(ns);
+        int msb = 4;
+        while ((ns >> (msb + 1)) != 0) ++msb;
+        return static_cast<size_t>((msb - 3) * 16 + ((ns >> (msb - 4)) & 0xF));
+    }
+
+    static std::uint64_t lowerBound(size_t bucket) {
+        if (bucket < 16) return bucket;
+        const int msb = static_cast<int>(bucket / 16) + 3;
+        return (16 + (bucket % 16)) << (msb - 4);
+    }
+
+public:
+    void record(std::uint64_t ns) {
+        ++buckets[bucketFor(ns)];
+        ++count;
+        if (ns > maxValue) maxValue = ns;
+    }
+
+    std::uint64_t percentile(double p) const {
+        if (count == 0) return 0;
+        const auto target = static_cast<std::uint64_t>(p * static_cast<double>(count - 1)) + 1;
+        std::uint64_t seen = 0;
+        for (size_t i = 0; i < buckets.size(); ++i) {
+            seen += buckets[i];
+            if (seen >= target) return lowerBound(i);
+        }
+        return maxValue;
+    }
+
+    std::uint64_t getMax() const { return maxValue; }
+    std::uint64_t getCount() const { return count; }
+};
+
+enum class Policy { Random, AI, Mcts, Script };
+
+struct Options {
+    std::string game = "all";
+    int games = 1000;
+    Policy policy = Policy::Random;
+    std::string scriptFile;
+    unsigned seed = 12345;
+    int maxMoves = 100000;
+    int aiDepth = 1;
+    int mctsMs = 50;
+    size_t threads = 0;
+    std::string opponent = "smart";   // Built-in m,n,k AI: smart, random or off
+    int opponentMs = 0;               // 0 = no time limit, so replies depend only on the seed
+    int opponentDepth = 2;
+    std::string recordFile;
+    std::string replayFile;
+};
+
+struct RunStats {
+    int finished = 0;
+    int stalled = 0;
+    std::uint64_t moves = 0;
+    std::uint64_t rejected = 0;
+    long long totalScore = 0;
+    int bestScore = 0;
+    LatencyHistogram moveLatency;
+    LatencyHistogram decisionLatency;
+    LatencyHistogram opponentLatency;
+    std::uint64_t playouts = 0;
+    double searchMs = 0.0;
+};
+
+/**
+ * AI players, kept across games so search threads and caches are reused
+ */
+struct Players {
+    Puzzle2048ExpectimaxAI expectimax;
+    Puzzle2048MctsAI mcts2048;
+    TicTacToeMctsAI mctsMnk;
+    SudokuSolver sudoku;
+    std::unique_ptr<TicTacToeStrategy> mnk;   // --policy ai for m,n,k games
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: GameStudioHeadless [options]\n"
+        "  --game NAME       Registered game name, or 'all' (default: all)\n"
+        "  --games N         Games to play per game type (default: 1000)\n"
+        "  --policy P        random | ai | mcts | script (default: random)\n"
+        "  --script FILE     Action script, one game per line (for --policy script)\n"
+        "  --seed N          Seed for game sessions and the random policy (default: 12345)\n"
+        "  --max-moves N     Move cap per game (default: 100000)\n"
+        "  --ai-depth N      Search depth with --policy ai: 2048 expectimax, Gomoku alpha-beta (default: 1)\n"
+        "  --mcts-ms N       Search time per move with --policy mcts, 2048 and m,n,k games only (default: 50)\n"
+        "  --threads N       MCTS search threads, 0 = all cores (default: 0)\n"
+        "  --opponent O      Built-in Tic-Tac-Toe/Gomoku AI: smart | random | off (default: smart)\n"
+        "  --opponent-ms N   Built-in alpha-beta AI time limit per reply, 0 = none (default: 0)\n"
+        "  --opponent-depth N  Built-in alpha-beta AI depth limit (default: 2)\n"
+        "  --record FILE     Save the last game played as a replay\n"
+        "  --replay FILE     Re-execute a replay at full speed and report the result\n"
+        "  --help            Show this message\n";
+}
+
+bool parseArgs(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--help") {
+            printUsage();
+            return false;
+        } else if (arg == "--game" && hasValue) {
+            options.game = argv[++i];
+        } else if (arg == "--games" && hasValue) {
+            options.games = std::stoi(argv[++i]);
+        } else if (arg == "--policy" && hasValue) {
+            const std::string policy = argv[++i];
+            if (policy == "random") options.policy = Policy::Random;
+            else if (policy == "ai") options.policy = Policy::AI;
+            else if (policy == "mcts") options.policy = Policy::Mcts;
+            else if (policy == "script") options.policy = Policy::Script;
+            else {
+                std::cerr << "Unknown policy: " << policy << std::endl;
+                return false;
+            }
+        } else if (arg == "--script" && hasValue) {
+            options.scriptFile = argv[++i];
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = static_cast<unsigned>(std::stoul(argv[++i]));
+        } else if (arg == "--max-moves" && hasValue) {
+            options.maxMoves = std::stoi(argv[++i]);
+        } else if (arg == "--ai-depth" && hasValue) {
+            options.aiDepth = std::stoi(argv[++i]);
+        } else if (arg == "--mcts-ms" && hasValue) {
+            options.mctsMs = std::stoi(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<size_t>(std::stoul(argv[++i]));
+        } else if (arg == "--opponent" && hasValue) {
+            options.opponent = argv[++i];
+            if (options.opponent != "smart" && options.opponent != "random" && options.opponent != "off") {
+                std::cerr << "Unknown opponent: " << options.opponent << std::endl;
+                return false;
+            }
+        } else if (arg == "--opponent-ms" && hasValue) {
+            options.opponentMs = std::stoi(argv[++i]);
+        } else if (arg == "--opponent-depth" && hasValue) {
+            options.opponentDepth = std::stoi(argv[++i]);
+        } else if (arg == "--record" && hasValue) {
+            options.recordFile = argv[++i];
+        } else if (arg == "--replay" && hasValue) {
+            options.replayFile = argv[++i];
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+            printUsage();
+            return false;
+        }
+    }
+    if (options.policy == Policy::Script && options.scriptFile.empty()) {
+        std::cerr << "--policy script requires --script FILE" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Load a script: each non-empty line lists the action codes for one game
+ */
+std::vector<std::vector<int>> loadScript(const std::string& filename) {
+    std::vector<std::vector<int>> script;
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open script: " + filename);
+    }
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        std::istringstream ss(line);
+        std::vector<int> actions;
+        int action;
+        while (ss >> action) {
+            actions.push_back(action);
+        }
+        script.push_back(std::move(actions));
+    }
+    return script;
+}
+
+const char* policyName(Policy policy) {
+    switch (policy) {
+        case Policy::AI: return "ai";
+        case Policy::Mcts: return "mcts";
+        case Policy::Script: return "script";
+        case Policy::Random:
+        default: return "random";
+    }
+}
+
+/**
+ * Check that a policy can drive a game
+ * random and script play any engine; ai has a player for 2048 (expectimax),
+ * Sudoku (solver) and m,n,k games (perfect-play table or alpha-beta); mcts
+ * searches 2048 and m,n,k games only
+ */
+bool supportsPolicy(const GameEngine& game, Policy policy) {
+    const bool puzzle2048 = dynamic_cast<const Puzzle2048Engine*>(&game) != nullptr;
+    const bool mnk = dynamic_cast<const TicTacToeEngine*>(&game) != nullptr;
+    if (policy == Policy::AI) {
+        return puzzle2048 || mnk || dynamic_cast<const SudokuEngine*>(&game) != nullptr;
+    }
+    if (policy == Policy::Mcts) {
+        return puzzle2048 || mnk;
+    }
+    return true;
+}
+
+/**
+ * Choose the next Sudoku action under --policy ai: fill the first empty cell
+ * from the solution, which is solved once per game on the first move
+ * @return Action code, or -1 if the board has no solution or no empty cell
+ */
+int nextSudokuAction(const SudokuEngine& sudoku, SudokuSolver& solver,
+                     std::optional<SudokuSolver::Puzzle>& solution) {
+    const Grid<int, 9, 9>& board = sudoku.getBoard();
+    if (!solution) {
+        SudokuSolver::Puzzle puzzle{};
+        for (size_t i = 0; i < puzzle.size(); ++i) {
+            puzzle[i] = static_cast<std::uint8_t>(board(i / 9, i % 9));
+        }
+        const SudokuSolver::Result result = solver.solve(puzzle);
+        if (result.solutionCount == 0) return -1;
+        solution = result.solution;
+    }
+    for (size_t i = 0; i < solution->size(); ++i) {
+        if (board(i / 9, i % 9) == 0) {
+            return static_cast<int>((i / 9) * 81 + (i % 9) * 9) + (*solution)[i] - 1;
+        }
+    }
+    return -1;
+}
+
+std::uint64_t elapsedNs(Clock::time_point start) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+void playGame(GameEngine& game, const Options& options, const std::vector<int>* scriptLine,
+              std::mt19937& rng, Players& players, RunStats& stats) {
+    game.init();
+    auto* puzzle2048 = dynamic_cast<Puzzle2048Engine*>(&game);
+    auto* mnk = dynamic_cast<TicTacToeEngine*>(&game);
+    auto* sudoku = dynamic_cast<SudokuEngine*>(&game);
+    std::optional<SudokuSolver::Puzzle> sudokuSolution;
+    size_t scriptPos = 0;
+
+    for (int move = 0; move < options.maxMoves && !game.isFinished(); ++move) {
+        const auto decisionStart = Clock::now();
+        int action = -1;
+        if (scriptLine) {
+            if (scriptPos >= scriptLine->size()) break;
+            action = (*scriptLine)[scriptPos++];
+        } else if (options.policy == Policy::AI && puzzle2048) {
+            auto best = players.expectimax.chooseMove(puzzle2048->getBitboard());
+            if (!best) break;
+            action = static_cast<int>(*best);
+        } else if (options.policy == Policy::AI && sudoku) {
+            action = nextSudokuAction(*sudoku, players.sudoku, sudokuSolution);
+            if (action < 0) break;
+        } else if (options.policy == Policy::AI && mnk) {
+            action = players.mnk->chooseMove(mnk->getBoard(), mnk->getCurrentPlayer());
+            if (action < 0) break;
+        } else if (options.policy == Policy::Mcts && puzzle2048) {
+            auto best = players.mcts2048.chooseMove(puzzle2048->getBitboard());
+            if (!best) break;
+            action = static_cast<int>(*best);
+            stats.playouts += players.mcts2048.getLastStats().playouts;
+            stats.searchMs += players.mcts2048.getLastStats().elapsedMs;
+        } else if (options.policy == Policy::Mcts && mnk) {
+            action = players.mctsMnk.chooseMove(mnk->getBoard(), mnk->getCurrentPlayer());
+            if (action < 0) break;
+            stats.playouts += players.mctsMnk.getLastStats().playouts;
+            stats.searchMs += players.mctsMnk.getLastStats().elapsedMs;
+        } else {
+            const std::vector<int> actions = game.getLegalActions();
+            if (actions.empty()) break;
+            std::uniform_int_distribution<size_t> pick(0, actions.size() - 1);
+            action = actions[pick(rng)];
+        }
+        stats.decisionLatency.record(elapsedNs(decisionStart));
+
+        const auto moveStart = Clock::now();
+        const bool applied = game.applyAction(action);
+        stats.moveLatency.record(elapsedNs(moveStart));
+        if (applied) {
+            ++stats.moves;
+        } else {
+            ++stats.rejected;
+        }
+
+        // The built-in opponent replies outside applyAction, on this thread
+        if (mnk && mnk->isAITurn()) {
+            const auto replyStart = Clock::now();
+            mnk->playAIMove();
+            stats.opponentLatency.record(elapsedNs(replyStart));
+        }
+    }
+
+    if (game.isFinished()) {
+        ++stats.finished;
+    } else {
+        ++stats.stalled;
+    }
+    if (puzzle2048) {
+        stats.totalScore += puzzle2048->getScore();
+        if (puzzle2048->getScore() > stats.bestScore) stats.bestScore = puzzle2048->getScore();
+    }
+}
+
+void printLatency(const char* label, const LatencyHistogram& histogram) {
+    std::cout << "  " << label << " latency (us): "
+              << "p50 " << histogram.percentile(0.50) / 1000.0
+              << "  p90 " << histogram.percentile(0.90) / 1000.0
+              << "  p99 " << histogram.percentile(0.99) / 1000.0
+              << "  p99.9 " << histogram.percentile(0.999) / 1000.0
+              << "  max " << histogram.getMax() / 1000.0 << "\n";
+}
+
+/**
+ * Play one game type and print its report
+ * @return false if the policy cannot drive the game
+ */
+bool runGameType(const EngineFactory& factory, const std::string& name, const Options& options,
+                 const std::vector<std::vector<int>>& script) {
+    const auto probe = factory.create(name);
+    if (!supportsPolicy(*probe, options.policy)) {
+        std::cerr << name << ": --policy " << policyName(options.policy) << " is not supported" << std::endl;
+        return false;
+    }
+
+    std::mt19937 rng(options.seed);
+    Puzzle2048ExpectimaxAI::Config aiConfig;
+    aiConfig.depth = options.aiDepth;
+
+    // m,n,k games need the board's win length before the first search
+    TicTacToeMctsAI::Config mnkConfig;
+    std::unique_ptr<TicTacToeStrategy> mnkAI;
+    if (auto* mnk = dynamic_cast<TicTacToeEngine*>(probe.get())) {
+        mnkConfig.winLength = mnk->getWinLength();
+        const Grid<char>& board = mnk->getBoard();
+        if (board.getRows() == 3 && board.getCols() == 3 && mnk->getWinLength() == 3) {
+            mnkAI = std::make_unique<TicTacToePerfectAI>();
+        } else {
+            MnkAlphaBetaAI::Config alphaBetaConfig;
+            alphaBetaConfig.winLength = mnk->getWinLength();
+            alphaBetaConfig.maxDepth = options.aiDepth;
+            mnkAI = std::make_unique<MnkAlphaBetaAI>(alphaBetaConfig);
+        }
+    }
+    mnkConfig.timeLimitMs = options.mctsMs;
+    mnkConfig.threads = options.threads;
+    Puzzle2048MctsAI::Config mctsConfig;
+    mctsConfig.timeLimitMs = options.mctsMs;
+    mctsConfig.threads = options.threads;
+
+    Players players{Puzzle2048ExpectimaxAI(aiConfig), Puzzle2048MctsAI(mctsConfig), TicTacToeMctsAI(mnkConfig),
+                    SudokuSolver(), std::move(mnkAI)};
+    RunStats stats;
+    Replay replay;
+    replay.game = name;
+
+    const auto start = Clock::now();
+    for (int i = 0; i < options.games; ++i) {
+        auto game = factory.create(name);
+        game->setSeed(static_cast<std::uint32_t>(rng()));
+        if (auto* mnk = dynamic_cast<TicTacToeEngine*>(game.get())) {
+            mnk->setVsAI(options.opponent != "off");
+            mnk->setAILimits(options.opponentMs > 0 ? options.opponentMs : UnlimitedOpponentMs,
+                             options.opponentDepth);
+            mnk->setAIStrategy(options.opponent == "smart");
+        }
+        if (!options.recordFile.empty()) {
+            game->setRecording(&replay);   // Each session restarts the recording
+        }
+        const std::vector<int>* scriptLine = script.empty() ? nullptr : &script[i % script.size()];
+        playGame(*game, options, scriptLine, rng, players, stats);
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    if (!options.recordFile.empty() && options.games > 0) {
+        replay.save(options.recordFile);
+    }
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << name << "\n";
+    std::cout << "  games: " << options.games
+              << "  finished: " << stats.finished
+              << "  stalled: " << stats.stalled << "\n";
+    std::cout << "  moves: " << stats.moves
+              << "  rejected: " << stats.rejected
+              << "  avg/game: " << (options.games > 0 ? double(stats.moves) / options.games : 0.0) << "\n";
+    std::cout << "  elapsed: " << seconds << " s"
+              << "  games/s: " << (seconds > 0 ? options.games / seconds : 0.0)
+              << "  moves/s: " << (seconds > 0 ? stats.moves / seconds : 0.0) << "\n";
+    if (name == "2048" && options.games > 0) {
+        std::cout << "  avg score: " << double(stats.totalScore) / options.games
+                  << "  best score: " << stats.bestScore << "\n";
+    }
+    if (stats.playouts > 0) {
+        std::cout << "  MCTS playouts: " << stats.playouts
+                  << "  playouts/s: " << (stats.searchMs > 0 ? stats.playouts * 1000.0 / stats.searchMs : 0.0)
+                  << "\n";
+    }
+    printLatency("move", stats.moveLatency);
+    printLatency("decision", stats.decisionLatency);
+    if (stats.opponentLatency.getCount() > 0) {
+        printLatency("opponent", stats.opponentLatency);
+    }
+    return true;
+}
+
+/**
+ * Re-execute a replay and report how it ended
+ * @return false if the replay is unreadable or desynchronized
+ */
+bool runReplay(const EngineFactory& factory, const std::string& path) {
+    Replay replay;
+    if (!replay.load(path)) {
+        return false;
+    }
+    auto game = factory.create(replay.game);
+    if (!game) {
+        std::cerr << "Unknown game in replay: " << replay.game << std::endl;
+        return false;
+    }
+
+    const auto start = Clock::now();
+    ReplayPlayer player(replay, *game);
+    player.runToEnd();
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << replay.game << " replay\n";
+    std::cout << "  seed: " << replay.seed
+              << "  actions: " << player.getLength()
+              << "  rejected: " << player.getRejected()
+              << "  finished: " << (game->isFinished() ? "yes" : "no") << "\n";
+    if (auto* puzzle2048 = dynamic_cast<Puzzle2048Engine*>(game.get())) {
+        std::cout << "  score: " << puzzle2048->getScore() << "\n";
+    }
+    std::cout << "  elapsed: " << seconds * 1000.0 << " ms"
+              << "  actions/s: " << (seconds > 0 ? player.getLength() / seconds : 0.0) << "\n";
+    return player.getRejected() == 0;
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        if (!parseArgs(argc, argv, options)) {
+            return 1;
+        }
+
+        // No observers: headless runs do not record scores
+        Subject subject;
+        EngineFactory factory;
+        BuiltinEngines::registerAll(factory, subject);
+
+        if (!options.replayFile.empty()) {
+            return runReplay(factory, options.replayFile) ? 0 : 1;
+        }
+
+        std::vector<std::vector<int>> script;
+        if (options.policy == Policy::Script) {
+            script = loadScript(options.scriptFile);
+        }
+
+        std::vector<std::string> names;
+        if (options.game == "all") {
+            names = factory.getGameNames();
+            std::sort(names.begin(), names.end());
+        } else {
+            names.push_back(options.game);
+        }
+
+        // 'all' skips the games the policy cannot drive; a named game must be playable
+        for (const auto& name : names) {
+            if (!runGameType(factory, name, options, script) && options.game != "all") {
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
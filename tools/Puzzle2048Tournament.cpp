@@ -0,0 +1,293 @@
+#include "ai/Puzzle2048ExpectimaxAI.hpp"
+#include "ai/Puzzle2048MctsAI.hpp"
+#include "games/Puzzle2048Engine.hpp"
+#include "util/WorkStealingPool.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * 2048 strategy tournament
+ * Plays the same numbered games with every strategy, spread over all cores
+ * in chunks that each own their engine and AI, so throughput scales with
+ * the thread count. Game i is seeded identically for every strategy, so
+ * strategies face the same opening spawns. Reports the score distribution,
+ * the max-tile histogram and moves/second per strategy.
+ */
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t ChunkGames = 8;   // Games per pool task (one AI instance per task)
+
+enum class StrategyKind { Random, Greedy, Expectimax, Mcts };
+
+struct Strategy {
+    std::string name;
+    StrategyKind kind = StrategyKind::Random;
+    int parameter = 0;   // Expectimax depth or MCTS playouts per move
+};
+
+struct Options {
+    std::vector<Strategy> strategies;
+    size_t games = 1000;
+    size_t threads = 0;
+    std::uint64_t seed = 2048;
+    int maxMoves = 100000;
+};
+
+struct GameResult {
+    int score = 0;
+    int maxExponent = 0;
+    int moves = 0;
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: Puzzle2048Tournament [options]\n"
+        "  --strategy S      random, greedy, expectimax:DEPTH or mcts:PLAYOUTS; repeat to compare\n"
+        "                    (default: random, greedy, expectimax:1)\n"
+        "  --games N         Games per strategy (default: 1000)\n"
+        "  --threads N       Worker threads, 0 = all cores (default: 0)\n"
+        "  --seed N          Base seed; game i uses the same seed for every strategy (default: 2048)\n"
+        "  --max-moves N     Move cap per game (default: 100000)\n"
+        "  --help            Show this message\n";
+}
+
+bool parseStrategy(const std::string& text, Strategy& strategy) {
+    const size_t colon = text.find(':');
+    const std::string kind = text.substr(0, colon);
+    const int parameter = colon == std::string::npos ? 0 : std::stoi(text.substr(colon + 1));
+    strategy.name = text;
+    strategy.parameter = parameter;
+    if (kind == "random") {
+        strategy.kind = StrategyKind::Random;
+    } else if (kind == "greedy") {
+        strategy.kind = StrategyKind::Greedy;
+    } else if (kind == "expectimax") {
+        strategy.kind = StrategyKind::Expectimax;
+        strategy.parameter = colon == std::string::npos ? 1 : parameter;
+    } else if (kind == "mcts") {
+        strategy.kind = StrategyKind::Mcts;
+        strategy.parameter = colon == std::string::npos ? 200 : parameter;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+bool parseArgs(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--help") {
+            printUsage();
+            return false;
+        } else if (arg == "--strategy" && hasValue) {
+            Strategy strategy;
+            if (!parseStrategy(argv[++i], strategy)) {
+                std::cerr << "Unknown strategy: " << argv[i] << std::endl;
+                return false;
+            }
+            options.strategies.push_back(strategy);
+        } else if (arg == "--games" && hasValue) {
+            options.games = std::stoul(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::stoul(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = std::stoull(argv[++i]);
+        } else if (arg == "--max-moves" && hasValue) {
+            options.maxMoves = std::stoi(argv[++i]);
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+            printUsage();
+            return false;
+        }
+    }
+    if (options.strategies.empty()) {
+        for (const char* name : {"random", "greedy", "expectimax:1"}) {
+            Strategy strategy;
+            parseStrategy(name, strategy);
+            options.strategies.push_back(strategy);
+        }
+    }
+    return true;
+}
+
+/**
+ * Seed of game i (SplitMix64 of base + i, so neighbouring games are unrelated)
+ */
+std::uint32_t gameSeed(std::uint64_t base, size_t game) {
+    std::uint64_t z = base + 0x9E3779B97F4A7C15ull * (game + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>(z ^ (z >> 31));
+}
+
+/**
+ * Move-picking player for one chunk of games
+ */
+class Player {
+    const Strategy& strategy;
+    std::unique_ptr<Puzzle2048ExpectimaxAI> expectimax;
+    std::unique_ptr<Puzzle2048MctsAI> mcts;
+    std::mt19937 rng;
+
+public:
+    Player(const Strategy& s, std::uint32_t seed) : strategy(s), rng(seed) {
+        if (strategy.kind == StrategyKind::Expectimax) {
+            Puzzle2048ExpectimaxAI::Config config;
+            config.depth = strategy.parameter;
+            expectimax = std::make_unique<Puzzle2048ExpectimaxAI>(config);
+        } else if (strategy.kind == StrategyKind::Mcts) {
+            // Playout-bounded and single-threaded: the tournament already uses every core
+            Puzzle2048MctsAI::Config config;
+            config.threads = 1;
+            config.maxPlayouts = static_cast<std::uint64_t>(strategy.parameter);
+            config.timeLimitMs = 60000;
+            config.seed = seed;
+            mcts = std::make_unique<Puzzle2048MctsAI>(config);
+        }
+    }
+
+    std::optional<Board2048::Direction> chooseMove(const Board2048& board) {
+        switch (strategy.kind) {
+            case StrategyKind::Expectimax:
+                return expectimax->chooseMove(board);
+            case StrategyKind::Mcts:
+                return mcts->chooseMove(board);
+            case StrategyKind::Greedy: {
+                // Most points, then most empty cells
+                std::optional<Board2048::Direction> best;
+                int bestValue = -1;
+                for (int d = 0; d < 4; ++d) {
+                    const auto dir = static_cast<Board2048::Direction>(d);
+                    Board2048 next = board;
+                    int gained = 0;
+                    if (!next.move(dir, gained)) continue;
+                    const int value = gained * 16 + next.countEmpty();
+                    if (value > bestValue) {
+                        bestValue = value;
+                        best = dir;
+                    }
+                }
+                return best;
+            }
+            case StrategyKind::Random:
+            default: {
+                Board2048::Direction legal[4];
+                int count = 0;
+                for (int d = 0; d < 4; ++d) {
+                    const auto dir = static_cast<Board2048::Direction>(d);
+                    if (Board2048::shift(board.raw(), dir) != board.raw()) {
+                        legal[count++] = dir;
+                    }
+                }
+                if (count == 0) return std::nullopt;
+                return legal[rng() % count];
+            }
+        }
+    }
+};
+
+GameResult playGame(Puzzle2048Engine& engine, Player& player, std::uint32_t seed, int maxMoves) {
+    engine.setSeed(seed);
+    engine.init();
+    GameResult result;
+    while (result.moves < maxMoves && !engine.isFinished()) {
+        const auto dir = player.chooseMove(engine.getBitboard());
+        if (!dir || !engine.move(*dir)) break;
+        ++result.moves;
+    }
+    result.score = engine.getScore();
+    result.maxExponent = engine.getBitboard().getMaxExponent();
+    return result;
+}
+
+double percentile(const std::vector<int>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    const size_t index = std::min(sorted.size() - 1, static_cast<size_t>(p * (sorted.size() - 1) + 0.5));
+    return sorted[index];
+}
+
+void printReport(const Strategy& strategy, const std::vector<GameResult>& results, double seconds) {
+    std::vector<int> scores;
+    scores.reserve(results.size());
+    std::array<size_t, Board2048::MaxExponent + 1> maxTiles{};
+    std::uint64_t moves = 0;
+    double totalScore = 0.0;
+    for (const GameResult& result : results) {
+        scores.push_back(result.score);
+        ++maxTiles[result.maxExponent];
+        moves += static_cast<std::uint64_t>(result.moves);
+        totalScore += result.score;
+    }
+    std::sort(scores.begin(), scores.end());
+    const double games = static_cast<double>(results.size());
+
+    std::cout << "\n" << strategy.name << ": " << results.size() << " games in " << std::setprecision(2)
+              << seconds << std::setprecision(1) << " s ("
+              << (seconds > 0 ? games / seconds : 0.0) << " games/s, "
+              << (seconds > 0 ? moves / seconds : 0.0) << " moves/s)\n";
+    std::cout << "  score: mean " << (games > 0 ? totalScore / games : 0.0)
+              << "  min " << percentile(scores, 0.0)
+              << "  p10 " << percentile(scores, 0.10)
+              << "  p50 " << percentile(scores, 0.50)
+              << "  p90 " << percentile(scores, 0.90)
+              << "  max " << percentile(scores, 1.0) << "\n";
+    std::cout << "  max tile      games   reached\n";
+    size_t reached = results.size();
+    for (int e = 1; e <= Board2048::MaxExponent; ++e) {
+        if (maxTiles[e] > 0) {
+            std::cout << "  " << std::setw(8) << (1 << e) << std::setw(10) << maxTiles[e]
+                      << std::setw(9) << (games > 0 ? 100.0 * reached / games : 0.0) << "%\n";
+        }
+        reached -= maxTiles[e];
+    }
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        if (!parseArgs(argc, argv, options)) {
+            return 1;
+        }
+
+        WorkStealingPool pool(options.threads);
+        std::cout << "Playing " << options.games << " games per strategy on " << pool.getThreadCount()
+                  << " threads" << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+
+        for (const Strategy& strategy : options.strategies) {
+            std::vector<GameResult> results(options.games);
+            const auto start = Clock::now();
+            for (size_t first = 0; first < options.games; first += ChunkGames) {
+                const size_t last = std::min(options.games, first + ChunkGames);
+                pool.submit([&, first, last]() {
+                    Puzzle2048Engine engine;
+                    Player player(strategy, gameSeed(options.seed ^ 0xA5A5A5A5u, first));
+                    for (size_t game = first; game < last; ++game) {
+                        results[game] = playGame(engine, player, gameSeed(options.seed, game), options.maxMoves);
+                    }
+                });
+            }
+            pool.wait();
+            const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            printReport(strategy, results, seconds);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
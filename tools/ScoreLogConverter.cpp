@@ -0,0 +1,82 @@
+#include "util/ScoreBoard.hpp"
+#include "util/ScoreLog.hpp"
+#include "util/FileManager.hpp"
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+/**
+ * Convert a pipe-delimited scores.txt into a binary score log
+ *
+ * Usage: ScoreLogConverter <scores.txt> <scores.bin> [--force]
+ * The output must not exist unless --force is given; the converted log is
+ * reopened and checked entry by entry against the text file.
+ */
+int main(int argc, char* argv[]) {
+    std::string input;
+    std::string output;
+    bool force = false;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--force") {
+            force = true;
+        } else if (arg == "--help" || arg == "-h") {
+            std::cout << "Usage: ScoreLogConverter <scores.txt> <scores.bin> [--force]\n";
+            return 0;
+        } else if (input.empty()) {
+            input = arg;
+        } else if (output.empty()) {
+            output = arg;
+        } else {
+            std::cerr << "Unexpected argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+    if (input.empty() || output.empty()) {
+        std::cerr << "Usage: ScoreLogConverter <scores.txt> <scores.bin> [--force]" << std::endl;
+        return 1;
+    }
+    if (!FileManager::fileExists(input)) {
+        std::cerr << "Input not found: " << input << std::endl;
+        return 1;
+    }
+    if (FileManager::fileExists(output)) {
+        if (!force) {
+            std::cerr << "Output exists (use --force to overwrite): " << output << std::endl;
+            return 1;
+        }
+        std::remove(output.c_str());
+    }
+
+    ScoreBoard text(input);
+    const auto& entries = text.getEntries();
+
+    ScoreLog log;
+    if (!log.open(output) || !log.append(entries)) {
+        std::cerr << "Failed to write score log: " << output << std::endl;
+        return 1;
+    }
+
+    ScoreLog check;
+    if (!check.open(output) || check.size() != entries.size()) {
+        std::cerr << "Verification failed: record count mismatch" << std::endl;
+        return 1;
+    }
+    size_t numericResults = 0;
+    for (size_t i = 0; i < check.size(); ++i) {
+        const ScoreEntry converted = check.entry(i);
+        const ScoreEntry& original = entries[i];
+        if (converted.timestamp != original.timestamp || converted.playerName != original.playerName ||
+            converted.gameName != original.gameName || converted.result != original.result) {
+            std::cerr << "Verification failed at entry " << i << std::endl;
+            return 1;
+        }
+        if (check.record(i).outcome != static_cast<std::uint8_t>(ScoreLog::Outcome::Text)) {
+            ++numericResults;
+        }
+    }
+
+    std::cout << "Converted " << check.size() << " entries (" << numericResults << " numeric results, "
+              << check.stringCount() << " interned strings) to " << output << std::endl;
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include "ai/SudokuGenerator.hpp"
+#include "util/SudokuPuzzleBank.hpp"
+#include "util/WorkStealingPool.hpp"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+/**
+ * Sudoku puzzle bank generator
+ * Generates uniquely solvable puzzles on all cores, grades them by the
+ * techniques they need and writes the binary bank that SudokuGame maps at
+ * startup.
+ */
+
+namespace {
+struct Options {
+    std::string output = "assets/sudoku_bank.bin";
+    size_t perDifficulty = 500;   // Size of the shipped bank
+    size_t threads = 0;
+    std::uint64_t seed = 2048;
+    size_t maxAttempts = 100000;
+};
+
+void printUsage() {
+    std::cout <<
+        "Usage: SudokuBankGenerator [options]\n"
+        "  --output FILE         Bank file to write (default: assets/sudoku_bank.bin)\n"
+        "  --per-difficulty N    Puzzles per difficulty (default: 500)\n"
+        "  --threads N           Worker threads, 0 = all cores (default: 0)\n"
+        "  --seed N              Base seed (default: 2048)\n"
+        "  --max-attempts N      Puzzles generated before giving up (default: 100000)\n"
+        "  --help                Show this message\n";
+}
+
+bool parseArgs(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--help") {
+            printUsage();
+            return false;
+        } else if (arg == "--output" && hasValue) {
+            options.output = argv[++i];
+        } else if (arg == "--per-difficulty" && hasValue) {
+            options.perDifficulty = std::stoul(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = std::stoul(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = std::stoull(argv[++i]);
+        } else if (arg == "--max-attempts" && hasValue) {
+            options.maxAttempts = std::stoul(argv[++i]);
+        } else {
+            std::cerr << "Unknown or incomplete option: " << arg << std::endl;
+            printUsage();
+            return false;
+        }
+    }
+    return true;
+}
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        if (!parseArgs(argc, argv, options)) {
+            return 1;
+        }
+
+        WorkStealingPool pool(options.threads);
+        SudokuGenerator::BatchConfig config;
+        config.targets.fill(options.perDifficulty);
+        config.seed = options.seed;
+        config.maxAttempts = options.maxAttempts;
+
+        std::cout << "Generating " << options.perDifficulty << " puzzles per difficulty on "
+                  << pool.getThreadCount() << " threads..." << std::endl;
+        const auto start = std::chrono::steady_clock::now();
+        const auto puzzles = SudokuGenerator::generateBatch(config, pool);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        size_t total = 0;
+        for (int d = 0; d < SudokuSolver::DifficultyCount; ++d) {
+            const auto difficulty = static_cast<SudokuSolver::Difficulty>(d);
+            std::cout << "  " << std::left << std::setw(8) << SudokuSolver::difficultyName(difficulty)
+                      << puzzles[d].size() << "\n";
+            if (puzzles[d].size() < options.perDifficulty) {
+                std::cerr << "  warning: only " << puzzles[d].size() << " "
+                          << SudokuSolver::difficultyName(difficulty) << " puzzles found" << std::endl;
+            }
+            total += puzzles[d].size();
+        }
+        std::cout << std::fixed << std::setprecision(2) << "  " << total << " puzzles in " << seconds
+                  << " s (" << (seconds > 0 ? total / seconds : 0.0) << " puzzles/s)" << std::endl;
+
+        if (!SudokuPuzzleBank::write(options.output, puzzles)) {
+            return 1;
+        }
+        std::cout << "Wrote " << options.output << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}